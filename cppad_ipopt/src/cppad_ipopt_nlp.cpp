@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <limits>
 
@@ -67,7 +67,7 @@ The following values are set by the constructor and are const
 or effectively const; i.e., they are set by the constructor and should
 not be changed:
 \verbatim
-    n_, m_, x_i_, x_l_, x_u_, g_l_, g_u_, K_, L_, p_, q_, retape_,
+    n_, m_, x_i_, x_l_, x_u_, g_l_, g_u_, K_, L_, p_, q_, retape_, par_for_,
     pattern_jac_r_, pattern_hes_r_, index_jac_g_, index_hes_fg_,
     nnz_jac_g_, iRow_jac_g_, jCol_jac_g_,
     nnz_h_lag_, iRow_h_lag_, jCol_h_lag_,
@@ -126,7 +126,8 @@ cppad_ipopt_nlp::cppad_ipopt_nlp(
     fg_info_->set_m(m);
 
     // get information from derived class version of fg_info
-    K_ = fg_info_->number_functions();
+    K_       = fg_info_->number_functions();
+    par_for_ = fg_info_->parallel_for();
     L_.resize(K_);
     p_.resize(K_);
     q_.resize(K_);
@@ -135,6 +136,12 @@ cppad_ipopt_nlp::cppad_ipopt_nlp(
     tape_ok_.resize(K_);
     pattern_jac_r_.resize(K_);
     pattern_hes_r_.resize(K_);
+    row_jac_r_.resize(K_);
+    col_jac_r_.resize(K_);
+    work_jac_r_.resize(K_);
+    row_hes_r_.resize(K_);
+    col_hes_r_.resize(K_);
+    work_hes_r_.resize(K_);
     size_t max_p      = 0;
     size_t max_q      = 0;
     for(k = 0; k < K_; k++)
@@ -205,6 +212,32 @@ cppad_ipopt_nlp::cppad_ipopt_nlp(
         pattern_jac_r_, pattern_hes_r_    // outputs
     );
 
+    // Compute the colorings for the sparse derivatives of each r_k (u)
+    // that does not need retaping. These colorings are then used for
+    // all the terms that correspond to r_k (u).
+    for(k = 0; k < K_; k++) if( ! retape_[k] )
+    {   size_t ir, jr;
+        for(ir = 0; ir < p_[k]; ir++) for(jr = 0; jr < q_[k]; jr++)
+        if( pattern_jac_r_[k][ir * q_[k] + jr] )
+        {   row_jac_r_[k].push_back(ir);
+            col_jac_r_[k].push_back(jr);
+        }
+        for(ir = 0; ir < q_[k]; ir++) for(jr = 0; jr < q_[k]; jr++)
+        if( pattern_hes_r_[k][ir * q_[k] + jr] )
+        {   row_hes_r_[k].push_back(ir);
+            col_hes_r_[k].push_back(jr);
+        }
+        fg_info_->index(k, 0, I_, J_);
+        NumberVector u(q_[k]), w(p_[k]);
+        NumberVector jac_r(p_[k] * q_[k]), r_hes(q_[k] * q_[k]);
+        for(jr = 0; jr < q_[k]; jr++)
+            u[jr] = x_i_[ J_[jr] ];
+        for(ir = 0; ir < p_[k]; ir++)
+            w[ir] = 1.0;
+        sparse_jac_r(k, r_fun_[k], work_jac_r_[k], u, jac_r);
+        sparse_hes_r(k, r_fun_[k], work_hes_r_[k], u, w, r_hes);
+    }
+
     // mapping from (i,j) to Ipopt sparsity index for Jacobian of g
     jac_g_map(
         fg_info_, m_, n_, K_, L_, p_, q_, pattern_jac_r_,   // inputs
@@ -236,6 +269,286 @@ cppad_ipopt_nlp::cppad_ipopt_nlp(
 cppad_ipopt_nlp::~cppad_ipopt_nlp()
 {}
 
+/*!
+Evaluate the terms for one value of k using par_for_.
+
+\param k
+is the index of the function \f$ r_k (u) \f$ for the terms.
+
+\param x
+is a vector of size n_ containing the point at which to evaluate the terms.
+
+\param job
+If job is parallel_g, the result for each term is \f$ r_k (u) \f$.
+If job is parallel_jac_g, the result for each term is the
+Jacobian of \f$ r_k (u) \f$.
+If job is parallel_h, the result for each term is the
+Hessian of \f$ w^T r_k (u) \f$ where w is the weight vector for the term.
+
+\param obj_factor
+if job is parallel_h,
+this is the weight corresponding to the objective function f(x).
+
+\param lambda
+if job is parallel_h,
+this is a vector of size m_ containing the weights corresponding to g(x).
+
+\return
+If par_for_ is null, <tt>retape_[k]</tt> is true,
+or <tt>L_[k]</tt> is less than two, the return value is false
+and no calculations are done.
+Otherwise the return value is true and, for <tt>ell = 0 , ... , L_[k]-1</tt>,
+<tt>term_result_[ell]</tt> is the result for the term ell.
+(If job is parallel_h and none of the weights for the term ell are
+positive, <tt>term_result_[ell]</tt> is not set.)
+*/
+bool cppad_ipopt_nlp::parallel_terms(
+    size_t            k           ,
+    const Number*     x           ,
+    parallel_job_enum job         ,
+    Number            obj_factor  ,
+    const Number*     lambda      )
+{   if( par_for_ == nullptr || retape_[k] || L_[k] < 2 )
+        return false;
+    CPPAD_ASSERT_KNOWN( ! CppAD::thread_alloc::in_parallel() ,
+        "cppad_ipopt_nlp: parallel_for is not null and "
+        "evaluating in parallel mode"
+    );
+    size_t i, j, ell;
+    //
+    // r_fun_thread_, work_jac_r_thread_, work_hes_r_thread_
+    // Each thread copies r_fun_[k], work_jac_r_[k] and work_hes_r_[k]
+    // the first time they are needed so that the memory for the copies
+    // belongs to that thread and no object is shared between threads.
+    size_t num_threads = CppAD::thread_alloc::num_threads();
+    if( r_fun_thread_.size() < num_threads )
+    {   r_fun_thread_.resize(num_threads);
+        work_jac_r_thread_.resize(num_threads);
+        work_hes_r_thread_.resize(num_threads);
+    }
+    for(size_t thread = 0; thread < num_threads; thread++)
+    {   if( r_fun_thread_[thread].size() != K_ )
+        {   r_fun_thread_[thread].resize(K_);
+            work_jac_r_thread_[thread].resize(K_);
+            work_hes_r_thread_[thread].resize(K_);
+        }
+    }
+    //
+    // n_result
+    size_t n_result = p_[k];
+    if( job == parallel_jac_g )
+        n_result = p_[k] * q_[k];
+    else if( job == parallel_h )
+        n_result = q_[k] * q_[k];
+    //
+    // term_J_, term_w_, term_result_
+    // This memory is allocated here so it belongs to the current thread.
+    if( term_J_.size() < L_[k] )
+    {   term_J_.resize(L_[k]);
+        term_w_.resize(L_[k]);
+        term_result_.resize(L_[k]);
+    }
+    for(ell = 0; ell < L_[k]; ell++)
+    {   fg_info_->index(k, ell, I_, J_);
+        term_J_[ell].resize(q_[k]);
+        for(j = 0; j < q_[k]; j++)
+            term_J_[ell][j] = J_[j];
+        term_result_[ell].resize(n_result);
+        if( job == parallel_h )
+        {   term_w_[ell].resize(p_[k]);
+            for(i = 0; i < p_[k]; i++)
+            {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
+                if( I_[i] == 0 )
+                    term_w_[ell][i] = obj_factor;
+                else
+                    term_w_[ell][i] = lambda[ I_[i] - 1 ];
+            }
+        }
+    }
+    //
+    // term_result_
+    parallel_info_struct info;
+    info.nlp = this;
+    info.k   = k;
+    info.x   = x;
+    info.job = job;
+    par_for_(L_[k], parallel_task, reinterpret_cast<void*>(&info) );
+    //
+    return true;
+}
+
+/*!
+Evaluate one of the terms for parallel_terms.
+
+\param ell
+is the index of the term that is evaluated.
+
+\param v_info
+is a pointer to the parallel_info_struct for this evaluation.
+The result for this term is stored in <tt>term_result_[ell]</tt>
+without changing its size
+(so that no memory is returned to a different thread).
+*/
+void cppad_ipopt_nlp::parallel_task(size_t ell, void* v_info)
+{   size_t i, j;
+    parallel_info_struct* info =
+        reinterpret_cast<parallel_info_struct*>(v_info);
+    cppad_ipopt_nlp* nlp = info->nlp;
+    size_t           k   = info->k;
+    //
+    // fun, work_jac, work_hes
+    size_t thread = CppAD::thread_alloc::thread_num();
+    CPPAD_ASSERT_UNKNOWN( thread < nlp->r_fun_thread_.size() );
+    CppAD::ADFun<Number>& fun( nlp->r_fun_thread_[thread][k] );
+    CppAD::sparse_jacobian_work& work_jac(
+        nlp->work_jac_r_thread_[thread][k]
+    );
+    CppAD::sparse_hessian_work& work_hes(
+        nlp->work_hes_r_thread_[thread][k]
+    );
+    if( fun.size_var() == 0 )
+    {   fun      = nlp->r_fun_[k];
+        work_jac = nlp->work_jac_r_[k];
+        work_hes = nlp->work_hes_r_[k];
+    }
+    //
+    // u
+    const SizeVector& J( nlp->term_J_[ell] );
+    NumberVector u( nlp->q_[k] );
+    for(j = 0; j < nlp->q_[k]; j++)
+    {   CPPAD_ASSERT_UNKNOWN( J[j] < nlp->n_ );
+        u[j] = info->x[ J[j] ];
+    }
+    //
+    // r
+    NumberVector r( nlp->term_result_[ell].size() );
+    switch( info->job )
+    {   case parallel_g:
+        r = fun.Forward(0, u);
+        break;
+
+        case parallel_jac_g:
+        nlp->sparse_jac_r(k, fun, work_jac, u, r);
+        break;
+
+        case parallel_h:
+        {   const NumberVector& w( nlp->term_w_[ell] );
+            bool in_use = false;
+            for(i = 0; i < nlp->p_[k]; i++)
+                in_use |= w[i] > 0.;
+            if( ! in_use )
+                return;
+            nlp->sparse_hes_r(k, fun, work_hes, u, w, r);
+        }
+        break;
+    }
+    //
+    // term_result_[ell]
+    NumberVector& result( nlp->term_result_[ell] );
+    CPPAD_ASSERT_UNKNOWN( r.size() == result.size() );
+    for(i = 0; i < result.size(); i++)
+        result[i] = r[i];
+}
+
+/*!
+Compute the Jacobian of \f$ r_k (u) \f$ using the coloring in work_jac_r_.
+
+\param k
+is the index of the function \f$ r_k (u) \f$.
+It must be that <tt>retape_[k]</tt> is false.
+
+\param r_fun
+is an ADFun object that is equal to <tt>r_fun_[k]</tt>
+(it may be a copy that belongs to the current thread).
+
+\param work_jac
+is <tt>work_jac_r_[k]</tt>, or a copy of it that belongs to the
+current thread.
+The constructor computes <tt>work_jac_r_[k]</tt> by calling this routine
+with an empty work_jac.
+
+\param u
+is the argument at which to evaluate the Jacobian.
+
+\param jac_r
+is a vector of size <tt>p_[k] * q_[k]</tt>.
+On output, <tt>jac_r[i * q_[k] + j]</tt> is the partial of the i-th
+component of \f$ r_k (u) \f$ w.r.t. the j-th component of \f$ u \f$.
+*/
+void cppad_ipopt_nlp::sparse_jac_r(
+    size_t                       k        ,
+    CppAD::ADFun<Number>&        r_fun    ,
+    CppAD::sparse_jacobian_work& work_jac ,
+    const NumberVector&          u        ,
+    NumberVector&                jac_r    )
+{   CPPAD_ASSERT_UNKNOWN( ! retape_[k] );
+    CPPAD_ASSERT_UNKNOWN( jac_r.size() == p_[k] * q_[k] );
+    const SizeVector& row( row_jac_r_[k] );
+    const SizeVector& col( col_jac_r_[k] );
+    size_t nnz = row.size();
+    NumberVector jac(nnz);
+    if( q_[k] <= p_[k] ) r_fun.SparseJacobianForward(
+        u, pattern_jac_r_[k], row, col, jac, work_jac
+    );
+    else r_fun.SparseJacobianReverse(
+        u, pattern_jac_r_[k], row, col, jac, work_jac
+    );
+    for(size_t i = 0; i < jac_r.size(); i++)
+        jac_r[i] = 0.0;
+    for(size_t ell = 0; ell < nnz; ell++)
+        jac_r[ row[ell] * q_[k] + col[ell] ] = jac[ell];
+}
+
+/*!
+Compute the Hessian of \f$ w^T r_k (u) \f$ using the coloring in work_hes_r_.
+
+\param k
+is the index of the function \f$ r_k (u) \f$.
+It must be that <tt>retape_[k]</tt> is false.
+
+\param r_fun
+is an ADFun object that is equal to <tt>r_fun_[k]</tt>
+(it may be a copy that belongs to the current thread).
+
+\param work_hes
+is <tt>work_hes_r_[k]</tt>, or a copy of it that belongs to the
+current thread.
+The constructor computes <tt>work_hes_r_[k]</tt> by calling this routine
+with an empty work_hes.
+
+\param u
+is the argument at which to evaluate the Hessian.
+
+\param w
+is the vector of weights for the components of \f$ r_k (u) \f$.
+
+\param r_hes
+is a vector of size <tt>q_[k] * q_[k]</tt>.
+On output, <tt>r_hes[i * q_[k] + j]</tt> is the second partial of
+\f$ w^T r_k (u) \f$ w.r.t. the i-th and j-th components of \f$ u \f$.
+*/
+void cppad_ipopt_nlp::sparse_hes_r(
+    size_t                       k        ,
+    CppAD::ADFun<Number>&        r_fun    ,
+    CppAD::sparse_hessian_work&  work_hes ,
+    const NumberVector&          u        ,
+    const NumberVector&          w        ,
+    NumberVector&                r_hes    )
+{   CPPAD_ASSERT_UNKNOWN( ! retape_[k] );
+    CPPAD_ASSERT_UNKNOWN( r_hes.size() == q_[k] * q_[k] );
+    const SizeVector& row( row_hes_r_[k] );
+    const SizeVector& col( col_hes_r_[k] );
+    size_t nnz = row.size();
+    NumberVector hes(nnz);
+    r_fun.SparseHessian(
+        u, w, pattern_hes_r_[k], row, col, hes, work_hes
+    );
+    for(size_t i = 0; i < r_hes.size(); i++)
+        r_hes[i] = 0.0;
+    for(size_t ell = 0; ell < nnz; ell++)
+        r_hes[ row[ell] * q_[k] + col[ell] ] = hes[ell];
+}
+
 /*!
 Return dimension information about optimization problem.
 
@@ -596,33 +909,42 @@ bool cppad_ipopt_nlp::eval_g(
             tape_ok_[k] = false;
     }
 
-    for(k = 0; k < K_; k++) for(ell = 0; ell < L_[k]; ell++)
-    {   fg_info_->index(k, ell, I_, J_);
-        if( ! tape_ok_[k] )
-        {   // Record r_k for value of u corresponding to x
-            fun_record(
-                fg_info_        ,   // inputs
-                k               ,
-                p_              ,
-                q_              ,
-                n_              ,
-                x               ,
-                J_              ,
-                r_fun_              // output
-            );
-        }
-        tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
-        NumberVector u(q_[k]);
-        NumberVector r(p_[k]);
-        for(j = 0; j < q_[k]; j++)
-        {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
-            u[j]   = x[ J_[j] ];
-        }
-        r   = r_fun_[k].Forward(0, u);
-        for(i = 0; i < p_[k]; i++)
-        {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
-            if( I_[i] >= 1 )
-                g[ I_[i] - 1 ] += r[i];
+    for(k = 0; k < K_; k++)
+    {   // evaluate all the terms for this k in parallel (if possible)
+        Number not_used = 0.;
+        bool parallel = parallel_terms(k, x, parallel_g, not_used, nullptr);
+        for(ell = 0; ell < L_[k]; ell++)
+        {   fg_info_->index(k, ell, I_, J_);
+            NumberVector r(p_[k]);
+            if( parallel )
+                r = term_result_[ell];
+            else
+            {   if( ! tape_ok_[k] )
+                {   // Record r_k for value of u corresponding to x
+                    fun_record(
+                        fg_info_        ,   // inputs
+                        k               ,
+                        p_              ,
+                        q_              ,
+                        n_              ,
+                        x               ,
+                        J_              ,
+                        r_fun_              // output
+                    );
+                }
+                tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
+                NumberVector u(q_[k]);
+                for(j = 0; j < q_[k]; j++)
+                {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
+                    u[j]   = x[ J_[j] ];
+                }
+                r   = r_fun_[k].Forward(0, u);
+            }
+            for(i = 0; i < p_[k]; i++)
+            {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
+                if( I_[i] >= 1 )
+                    g[ I_[i] - 1 ] += r[i];
+            }
         }
     }
 # if CPPAD_IPOPT_NLP_TRACE
@@ -725,44 +1047,53 @@ bool cppad_ipopt_nlp::eval_jac_g(Index n, const Number* x, bool new_x,
             tape_ok_[k] = false;
     }
 
-    for(k = 0; k < K_; k++) for(ell = 0; ell < L_[k]; ell++)
-    {   fg_info_->index(k, ell, I_, J_);
-        if( ! tape_ok_[k] )
-        {   // Record r_k for value of u corresponding to x
-            fun_record(
-                fg_info_        ,   // inputs
-                k               ,
-                p_              ,
-                q_              ,
-                n_              ,
-                x               ,
-                J_              ,
-                r_fun_              // output
-            );
-        }
-        tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
-        NumberVector u(q_[k]);
-        NumberVector jac_r(p_[k] * q_[k]);
-        for(j = 0; j < q_[k]; j++)
-        {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
-            u[j]   = x[ J_[j] ];
-        }
-        if( retape_[k] )
-            jac_r = r_fun_[k].Jacobian(u);
-        else
-            jac_r = r_fun_[k].SparseJacobian(u, pattern_jac_r_[k]);
-        for(i = 0; i < p_[k]; i++) if( I_[i] != 0 )
-        {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
-            for(j = 0; j < q_[k]; j++)
-            {   index_ij = index_jac_g_[I_[i]-1].find(J_[j]);
-                if( index_ij != index_jac_g_[I_[i]-1].end() )
-                {   l          = index_ij->second;
-                    values[l] += jac_r[i * q_[k] + j];
+    for(k = 0; k < K_; k++)
+    {   // evaluate all the terms for this k in parallel (if possible)
+        Number not_used = 0.;
+        bool parallel = parallel_terms(k, x, parallel_jac_g, not_used, nullptr);
+        for(ell = 0; ell < L_[k]; ell++)
+        {   fg_info_->index(k, ell, I_, J_);
+            NumberVector jac_r(p_[k] * q_[k]);
+            if( parallel )
+                jac_r = term_result_[ell];
+            else
+            {   if( ! tape_ok_[k] )
+                {   // Record r_k for value of u corresponding to x
+                    fun_record(
+                        fg_info_        ,   // inputs
+                        k               ,
+                        p_              ,
+                        q_              ,
+                        n_              ,
+                        x               ,
+                        J_              ,
+                        r_fun_              // output
+                    );
                 }
+                tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
+                NumberVector u(q_[k]);
+                for(j = 0; j < q_[k]; j++)
+                {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
+                    u[j]   = x[ J_[j] ];
+                }
+                if( retape_[k] )
+                    jac_r = r_fun_[k].Jacobian(u);
                 else
-                    CPPAD_ASSERT_UNKNOWN(
-                    jac_r[i * q_[k] + j] == 0.
-                );
+                    sparse_jac_r(k, r_fun_[k], work_jac_r_[k], u, jac_r);
+            }
+            for(i = 0; i < p_[k]; i++) if( I_[i] != 0 )
+            {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
+                for(j = 0; j < q_[k]; j++)
+                {   index_ij = index_jac_g_[I_[i]-1].find(J_[j]);
+                    if( index_ij != index_jac_g_[I_[i]-1].end() )
+                    {   l          = index_ij->second;
+                        values[l] += jac_r[i * q_[k] + j];
+                    }
+                    else
+                        CPPAD_ASSERT_UNKNOWN(
+                        jac_r[i * q_[k] + j] == 0.
+                    );
+                }
             }
         }
     }
@@ -882,62 +1213,69 @@ bool cppad_ipopt_nlp::eval_h(Index n, const Number* x, bool new_x,
             tape_ok_[k] = false;
     }
 
-    for(k = 0; k < K_; k++) for(ell = 0; ell < L_[k]; ell++)
-    {   fg_info_->index(k, ell, I_, J_);
-        bool in_use = false;
-        for(i = 0; i < p_[k]; i++)
-        {   if( I_[i] == 0 )
-                in_use |= obj_factor > 0.;
-            else
-                in_use |= lambda[ I_[i] - 1 ] > 0;
-        }
-        if( in_use )
-        {
-            if( ! tape_ok_[k]  )
-            {   // Record r_k for value of u corresponding to x
-                fun_record(
-                    fg_info_        ,   // inputs
-                    k               ,
-                    p_              ,
-                    q_              ,
-                    n_              ,
-                    x               ,
-                    J_              ,
-                    r_fun_              // output
-                );
-                tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
-            }
-            NumberVector w(p_[k]);
-            NumberVector r_hes(q_[k] * q_[k]);
-            NumberVector u(q_[k]);
-            for(j = 0; j < q_[k]; j++)
-            {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
-                u[j]   = x[ J_[j] ];
-            }
+    for(k = 0; k < K_; k++)
+    {   // evaluate all the terms for this k in parallel (if possible)
+        bool parallel = parallel_terms(k, x, parallel_h, obj_factor, lambda);
+        for(ell = 0; ell < L_[k]; ell++)
+        {   fg_info_->index(k, ell, I_, J_);
+            bool in_use = false;
             for(i = 0; i < p_[k]; i++)
-            {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
-                if( I_[i] == 0 )
-                    w[i] = obj_factor;
+            {   if( I_[i] == 0 )
+                    in_use |= obj_factor > 0.;
                 else
-                    w[i] = lambda[ I_[i] - 1 ];
+                    in_use |= lambda[ I_[i] - 1 ] > 0;
             }
-            if( retape_[k] )
-                r_hes = r_fun_[k].Hessian(u, w);
-            else
-                r_hes = r_fun_[k].SparseHessian(
-                    u, w, pattern_hes_r_[k]
-            );
-            for(i = 0; i < q_[k]; i++) for(j = 0; j < q_[k]; j++)
-            if( J_[j] <= J_[i] )
-            {   index_ij = index_hes_fg_[J_[i]].find(J_[j]);
-                if( index_ij != index_hes_fg_[J_[i]].end() )
-                {   l          = index_ij->second;
-                    values[l] += r_hes[i * q_[k] + j];
-                }
+            if( in_use )
+            {   NumberVector r_hes(q_[k] * q_[k]);
+                if( parallel )
+                    r_hes = term_result_[ell];
                 else
-                    CPPAD_ASSERT_UNKNOWN(
-                    r_hes[i * q_[k] + j] == 0.
-                );
+                {   if( ! tape_ok_[k]  )
+                    {   // Record r_k for value of u corresponding to x
+                        fun_record(
+                            fg_info_        ,   // inputs
+                            k               ,
+                            p_              ,
+                            q_              ,
+                            n_              ,
+                            x               ,
+                            J_              ,
+                            r_fun_              // output
+                        );
+                        tape_ok_[k] = ! (retape_[k] || L_[k] > 1);
+                    }
+                    NumberVector w(p_[k]);
+                    NumberVector u(q_[k]);
+                    for(j = 0; j < q_[k]; j++)
+                    {   CPPAD_ASSERT_UNKNOWN( J_[j] < n_ );
+                        u[j]   = x[ J_[j] ];
+                    }
+                    for(i = 0; i < p_[k]; i++)
+                    {   CPPAD_ASSERT_UNKNOWN( I_[i] <= m_ );
+                        if( I_[i] == 0 )
+                            w[i] = obj_factor;
+                        else
+                            w[i] = lambda[ I_[i] - 1 ];
+                    }
+                    if( retape_[k] )
+                        r_hes = r_fun_[k].Hessian(u, w);
+                    else
+                        sparse_hes_r(
+                            k, r_fun_[k], work_hes_r_[k], u, w, r_hes
+                        );
+                }
+                for(i = 0; i < q_[k]; i++) for(j = 0; j < q_[k]; j++)
+                if( J_[j] <= J_[i] )
+                {   index_ij = index_hes_fg_[J_[i]].find(J_[j]);
+                    if( index_ij != index_hes_fg_[J_[i]].end() )
+                    {   l          = index_ij->second;
+                        values[l] += r_hes[i * q_[k] + j];
+                    }
+                    else
+                        CPPAD_ASSERT_UNKNOWN(
+                        r_hes[i * q_[k] + j] == 0.
+                    );
+                }
             }
         }
     }
@@ -2,7 +2,7 @@
 # define CPPAD_CPPAD_IPOPT_SRC_CPPAD_IPOPT_NLP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_ipopt_nlp app}
@@ -445,6 +445,54 @@ for :math:`i = 0 , \ldots , m`,
 and  for :math:`j = 0 , \ldots , n-1`,
 *J* [ *j* ] = *j* .
 
+fg_info.parallel_for
+====================
+This member function has prototype
+
+    ``virtual ParallelFor cppad_ipopt_fg_info::parallel_for`` ( ``void`` )
+
+where the type ``ParallelFor`` is defined by
+``cppad_ipopt_nlp.hpp`` as
+
+| |tab| ``typedef void`` (* ``ParallelFor`` )(
+| |tab| |tab| ``size_t`` *n_task* , ``void`` (* *task* )( ``size_t`` *i_task* , ``void*`` *info* ), ``void*`` *info*
+| |tab| )
+
+The syntax
+
+    *par_for* = *fg_info* . ``parallel_for`` ()
+
+sets *par_for* to a function that is used to evaluate the terms
+:math:`\ell = 0 , \ldots , L(k)-1` for a fixed value of :math:`k`
+in parallel.
+It is only used for the values of :math:`k` where
+*fg_info* . ``retape`` ( *k* ) is false and :math:`L(k) > 1`,
+and only for the evaluation of :math:`g(x)`,
+its Jacobian, and the Hessian of the Lagrangian.
+The syntax
+
+    *par_for* ( *n_task* , *task* , *info* )
+
+must execute *task* ( *i_task* , *info* )
+for *i_task* equal to 0, ... , *n_task* ``-1`` .
+These calls can be made in any order and by different threads,
+but they must all be completed before *par_for* returns.
+The results for the different terms are summed in the order
+:math:`\ell = 0 , \ldots , L(k)-1`; i.e.,
+the result does not depend on the order or threads used by *par_for* .
+
+If *par_for* uses multiple threads,
+the CppAD :ref:`multi_thread-name` requirements must be satisfied;
+e.g., :ref:`parallel_setup<ta_parallel_setup-name>` must have been
+called and the threads must have the corresponding
+:ref:`thread numbers<ta_thread_num-name>` .
+Each thread uses its own copy of the recording of :math:`r_k (u)`.
+The functions *fg_info* . ``eval_r`` and *fg_info* . ``index`` are only
+called by the thread that calls ``cppad_ipopt_nlp`` .
+
+The ``cppad_ipopt_fg_info`` implementation of this function
+returns null which means the terms are evaluated sequentially.
+
 solution
 ********
 After the optimization process is completed, *solution* contains
@@ -584,6 +632,10 @@ typedef CppAD::vector<ADNumber>        ADVector;
 typedef CppAD::vector<size_t>          SizeVector;
 /// A simple vector of values used by Ipopt
 typedef CppAD::vector<Ipopt::Number>   NumberVector;
+/// A function that executes a loop of tasks, possibly in parallel
+typedef void (*ParallelFor)(
+    size_t n_task, void (*task)(size_t i_task, void* info), void* info
+);
 
 /*!
 Abstract base class user derives from to define the functions in the problem.
@@ -637,6 +689,10 @@ public:
         for(size_t j = 0; j < n_; j++)
             J[j] = j;
     }
+    /// function used to evaluate the terms for one k in parallel
+    /// (default is null which means evaluate the terms sequentially)
+    virtual ParallelFor parallel_for(void)
+    {   return nullptr; }
 };
 
 /*!
@@ -740,9 +796,15 @@ private:
     typedef CppAD::vector< CppAD::ADFun<Number> > ADFunVector;
     /// A simple vector of simple vectors of boolean values
     typedef CppAD::vector<BoolVector>             BoolVectorVector;
+    /// A simple vector of simple vectors of size_t values
+    typedef CppAD::vector<SizeVector>             SizeVectorVector;
     /// A mapping that is dense in i, sparse in j, and maps (i, j)
     /// to the corresponding sparsity index in Ipopt.
     typedef CppAD::vector< std::map<size_t,size_t> > IndexMap;
+    /// A simple vector of sparse Jacobian colorings
+    typedef CppAD::vector<CppAD::sparse_jacobian_work> WorkJacVector;
+    /// A simple vector of sparse Hessian colorings
+    typedef CppAD::vector<CppAD::sparse_hessian_work>  WorkHesVector;
 
     // ------------------------------------------------------------------
     // Values directly passed in to constructor
@@ -824,6 +886,39 @@ private:
     */
     BoolVectorVector                 pattern_hes_r_;
 
+    /*!
+    Row and column indices for the Jacobian of \f$ r_k (u) \f$ (set by ctor).
+
+    For <tt>k = 0 , ... , K_-1</tt> with <tt>retape_[k]</tt> false,
+    <tt>row_jac_r_[k]</tt> and <tt>col_jac_r_[k]</tt>
+    are the row and column indices for the possibly non-zero entries
+    in <tt>pattern_jac_r_[k]</tt>.
+    (effectively const)
+    */
+    SizeVectorVector                 row_jac_r_;
+    /// column indices corresponding to row_jac_r_ (effectively const)
+    SizeVectorVector                 col_jac_r_;
+    /// For <tt>k = 0 , ... , K_-1</tt> with <tt>retape_[k]</tt> false,
+    /// <tt>work_jac_r_[k]</tt> is the coloring for the Jacobian of
+    /// \f$ r_k (u) \f$. It is computed by the constructor and then
+    /// used for all the terms that use \f$ r_k (u) \f$.
+    /// (effectively const)
+    WorkJacVector                    work_jac_r_;
+
+    /// For <tt>k = 0 , ... , K_-1</tt> with <tt>retape_[k]</tt> false,
+    /// <tt>row_hes_r_[k]</tt> and <tt>col_hes_r_[k]</tt>
+    /// are the row and column indices for the possibly non-zero entries
+    /// in <tt>pattern_hes_r_[k]</tt>. (effectively const)
+    SizeVectorVector                 row_hes_r_;
+    /// column indices corresponding to row_hes_r_ (effectively const)
+    SizeVectorVector                 col_hes_r_;
+    /// For <tt>k = 0 , ... , K_-1</tt> with <tt>retape_[k]</tt> false,
+    /// <tt>work_hes_r_[k]</tt> is the coloring for the Hessian of
+    /// \f$ r_k (u) \f$. It is computed by the constructor and then
+    /// used for all the terms that use \f$ r_k (u) \f$.
+    /// (effectively const)
+    WorkHesVector                    work_hes_r_;
+
     /// number non-zero is Ipopt sparsity structor for Jacobian of g(x)
     /// (effectively const)
     size_t                           nnz_jac_g_;
@@ -883,6 +978,44 @@ private:
     SizeVector             J_;
     /// work space of size equal maximum of <tt>p[k]</tt> w.r.t k.
     SizeVector             I_;
+    // -----------------------------------------------------------------
+    // Values used to evaluate the terms for one k in parallel:
+    // -----------------------------------------------------------------
+    /// which calculation is done by parallel_task
+    enum parallel_job_enum { parallel_g, parallel_jac_g, parallel_h };
+
+    /// function used to evaluate the terms in parallel
+    /// (null for sequential evaluation) (effectively const)
+    ParallelFor                      par_for_;
+
+    /// For <tt>thread = 0 , ... , num_threads-1, r_fun_thread_[thread]</tt>
+    /// is a vector of size K_ containing the copy of r_fun_
+    /// used by the specified thread (copied by that thread when needed).
+    CppAD::vector<ADFunVector>       r_fun_thread_;
+    /// copy of work_jac_r_ used by each thread (copied with r_fun_thread_)
+    CppAD::vector<WorkJacVector>     work_jac_r_thread_;
+    /// copy of work_hes_r_ used by each thread (copied with r_fun_thread_)
+    CppAD::vector<WorkHesVector>     work_hes_r_thread_;
+
+    /// <tt>term_J_[ell]</tt> is the index vector \f$ J_{k,\ell} \f$
+    CppAD::vector<SizeVector>        term_J_;
+    /// <tt>term_w_[ell]</tt> is the weight vector for the term ell
+    /// (only used by the Hessian calculation)
+    CppAD::vector<NumberVector>      term_w_;
+    /// <tt>term_result_[ell]</tt> is the result for the term ell
+    CppAD::vector<NumberVector>      term_result_;
+
+    /// information passed to parallel_task
+    struct parallel_info_struct {
+        /// the cppad_ipopt_nlp object
+        cppad_ipopt_nlp*  nlp;
+        /// the index k for the terms
+        size_t            k;
+        /// the value of x
+        const Number*     x;
+        /// the calculation to do
+        parallel_job_enum job;
+    };
     // ------------------------------------------------------------
     // Private Methods
     // ------------------------------------------------------------
@@ -890,6 +1023,33 @@ private:
     cppad_ipopt_nlp(const cppad_ipopt_nlp&);
     /// blocks the assignment operator from use
     cppad_ipopt_nlp& operator=(const cppad_ipopt_nlp&);
+    /// evaluate the terms for one k using par_for_
+    bool parallel_terms(
+        size_t            k           ,
+        const Number*     x           ,
+        parallel_job_enum job         ,
+        Number            obj_factor  ,
+        const Number*     lambda
+    );
+    /// evaluate one term (called by par_for_)
+    static void parallel_task(size_t ell, void* info);
+    /// Jacobian of r_k (u) using the coloring in a copy of work_jac_r_[k]
+    void sparse_jac_r(
+        size_t                       k        ,
+        CppAD::ADFun<Number>&        r_fun    ,
+        CppAD::sparse_jacobian_work& work_jac ,
+        const NumberVector&          u        ,
+        NumberVector&                jac_r
+    );
+    /// Hessian of w^T r_k (u) using the coloring in a copy of work_hes_r_[k]
+    void sparse_hes_r(
+        size_t                       k        ,
+        CppAD::ADFun<Number>&        r_fun    ,
+        CppAD::sparse_hessian_work&  work_hes ,
+        const NumberVector&          u        ,
+        const NumberVector&          w        ,
+        NumberVector&                r_hes
+    );
 public:
     // ----------------------------------------------------------------
     // See cppad_ipopt_nlp.cpp for doxygen documentation of these methods
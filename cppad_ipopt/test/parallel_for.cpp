@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad_ipopt_nlp.hpp>
+
+namespace { // Begin empty namespace
+using namespace cppad_ipopt;
+
+// ---------------------------------------------------------------------------
+/*
+A test case where the terms for each k are evaluated using parallel_for,
+retaping is not required, and L[k] > 1.
+*/
+// number of calls to par_for
+size_t n_par_for_ = 0;
+//
+// par_for: executes the tasks in reverse order (using one thread)
+void par_for(
+    size_t n_task, void (*task)(size_t i_task, void* info), void* info
+)
+{   ++n_par_for_;
+    for(size_t i = 0; i < n_task; ++i)
+        task(n_task - i - 1, info);
+}
+//
+class FG_info : public cppad_ipopt_fg_info
+{
+private:
+    // should the terms be evaluated using par_for
+    bool parallel_;
+public:
+    // derived class part of constructor
+    FG_info (bool parallel)
+    : parallel_(parallel)
+    { }
+    // r_0 (u) = (u_0 - u_1)^2
+    // r_1 (u) = u_0 * u_0 + u_1 * u_1
+    ADVector eval_r(size_t k, const ADVector&  u)
+    {   ADVector r(1);
+        if( k == 0 )
+            r[0] = (u[0] - u[1]) * (u[0] - u[1]);
+        else
+            r[0] = u[0] * u[0] + u[1] * u[1];
+        return r;
+    }
+    // operation sequence does not depend on u
+    bool retape(size_t k)
+    {   return false; }
+    // K = 2
+    size_t number_functions(void)
+    {   return 2; }
+    // q[k] = 2
+    size_t domain_size(size_t k)
+    {   return 2; }
+    // p[k] = 1
+    size_t range_size(size_t k)
+    {   return 1; }
+    // L[k] = 3
+    size_t number_terms(size_t k)
+    {   return 3; }
+    // I_{0,ell} = 0           // objective function index
+    // I_{1,ell} = ell + 1     // constraint index
+    // J_{k,ell} = (ell, 3)    // argument indices
+    void index(size_t k, size_t ell, SizeVector& I, SizeVector& J)
+    {   if( k == 0 )
+            I[0] = 0;
+        else
+            I[0] = ell + 1;
+        J[0] = ell;
+        J[1] = 3;
+    }
+    // evaluate the terms using par_for (if parallel_ is true)
+    ParallelFor parallel_for(void)
+    {   if( parallel_ )
+            return par_for;
+        return nullptr;
+    }
+};
+} // end empty namespace
+
+bool parallel_for(void)
+{   bool ok = true;
+    size_t j;
+
+    // number of independent variables (domain dimension for f and g)
+    size_t n = 4;
+    // number of constraints (range dimension for g)
+    size_t m = 3;
+    // initial value of the independent variables
+    NumberVector x_i(n);
+    for(j = 0; j < n; j++)
+        x_i[j] = 1.0;
+    // lower and upper limits for x
+    NumberVector x_l(n);
+    NumberVector x_u(n);
+    for(j = 0; j < n; j++)
+    {   x_l[j] = -5.0;
+        x_u[j] = +5.0;
+    }
+    // x_3 = 1
+    x_l[3] = 1.0;
+    x_u[3] = 1.0;
+    // lower and upper limits for g
+    // x_j^2 + x_3^2 = 1 + (j + 1)
+    NumberVector g_l(m);
+    NumberVector g_u(m);
+    for(size_t i = 0; i < m; i++)
+    {   g_l[i] = 1.0 + double(i + 1);
+        g_u[i] = 1.0 + double(i + 1);
+    }
+
+    // object in derived class
+    FG_info my_fg_info(true);
+    cppad_ipopt_fg_info *fg_info = &my_fg_info;
+
+    // create the Ipopt interface
+    cppad_ipopt_solution solution;
+    Ipopt::SmartPtr<Ipopt::TNLP> cppad_nlp = new cppad_ipopt_nlp(
+        n, m, x_i, x_l, x_u, g_l, g_u, fg_info, &solution
+    );
+
+    // Create an instance of the IpoptApplication
+    using Ipopt::IpoptApplication;
+    Ipopt::SmartPtr<IpoptApplication> app = new IpoptApplication();
+
+    // turn off any printing
+    app->Options()->SetIntegerValue("print_level", 0);
+    app->Options()->SetStringValue("sb", "yes");
+
+    // maximum number of iterations
+    app->Options()->SetIntegerValue("max_iter", 20);
+
+    // approximate accuracy in first order necessary conditions;
+    // see Mathematical Programming, Volume 106, Number 1,
+    // Pages 25-57, Equation (6)
+    app->Options()->SetNumericValue("tol", 1e-9);
+
+    // derivative testing
+    app->Options()-> SetStringValue("derivative_test", "second-order");
+    app->Options()-> SetNumericValue("point_perturbation_radius", 0.);
+
+    // Initialize the IpoptApplication and process the options
+    Ipopt::ApplicationReturnStatus status = app->Initialize();
+    ok    &= status == Ipopt::Solve_Succeeded;
+
+    // Run the IpoptApplication
+    n_par_for_ = 0;
+    status = app->OptimizeTNLP(cppad_nlp);
+    ok    &= status == Ipopt::Solve_Succeeded;
+
+    /*
+    Check the solution values
+    */
+    ok &= solution.status == cppad_ipopt_solution::success;
+    ok &= n_par_for_ > 0;
+    //
+    // x_j^2 = j + 1 and the objective is minimized by x_j > 0
+    double rel_tol     = 1e-6;  // relative tolerance
+    double abs_tol     = 1e-6;  // absolute tolerance
+    for(j = 0; j < 3; j++)
+    {   double check = std::sqrt( double(j + 1) );
+        ok &= CppAD::NearEqual(check, solution.x[j], rel_tol, abs_tol);
+    }
+    ok &= CppAD::NearEqual(1.0, solution.x[3], rel_tol, abs_tol);
+
+    /*
+    Check that evaluating the terms with par_for gives the same g(x),
+    Jacobian of g(x), and Hessian of the Lagrangian as evaluating them
+    without par_for (call the evaluation routines directly).
+    */
+    typedef Ipopt::Index  Index;
+    typedef Ipopt::Number Number;
+    Ipopt::TNLP::IndexStyleEnum index_style;
+    NumberVector x(n), lambda(m);
+    for(j = 0; j < n; j++)
+        x[j] = 0.5 + double(j);
+    for(size_t i = 0; i < m; i++)
+        lambda[i] = double(i + 1);
+    Number obj_factor = 2.0;
+    CppAD::vector<NumberVector> value(2);
+    for(size_t i_case = 0; i_case < 2; i_case++)
+    {   bool parallel = i_case == 1;
+        FG_info case_fg_info(parallel);
+        cppad_ipopt_nlp nlp(
+            n, m, x_i, x_l, x_u, g_l, g_u, &case_fg_info, &solution
+        );
+        Index n_nlp, m_nlp, nnz_jac, nnz_h;
+        nlp.get_nlp_info(n_nlp, m_nlp, nnz_jac, nnz_h, index_style);
+        NumberVector g(m), jac(nnz_jac), hes(nnz_h);
+        n_par_for_ = 0;
+        nlp.eval_g(n_nlp, x.data(), true, m_nlp, g.data());
+        nlp.eval_jac_g(n_nlp, x.data(), false, m_nlp, nnz_jac,
+            nullptr, nullptr, jac.data()
+        );
+        nlp.eval_h(n_nlp, x.data(), false, obj_factor, m_nlp,
+            lambda.data(), true, nnz_h, nullptr, nullptr, hes.data()
+        );
+        ok &= (n_par_for_ > 0) == parallel;
+        //
+        // value[i_case] = [ g, jac, hes ]
+        for(size_t i = 0; i < g.size(); i++)
+            value[i_case].push_back( g[i] );
+        for(size_t k = 0; k < jac.size(); k++)
+            value[i_case].push_back( jac[k] );
+        for(size_t k = 0; k < hes.size(); k++)
+            value[i_case].push_back( hes[k] );
+    }
+    // the terms are summed in the same order so the values are identical
+    ok &= value[0] == value[1];
+
+    return ok;
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four.cpp}
@@ -45,6 +45,7 @@ extern bool dynamic(void);
 extern bool forward(void);
 extern bool get_started(void);
 extern bool norm_sq(void);
+extern bool thread_work(void);
 // END_SORT_THIS_LINE_MINUS_1
 
 // main program that runs all the tests
@@ -61,6 +62,7 @@ int main(void)
     Run( forward,             "forward"        );
     Run( get_started,         "get_started"    );
     Run( norm_sq,             "norm_sq"        );
+    Run( thread_work,         "thread_work"    );
     // END_SORT_THIS_LINE_MINUS_1
 
     // check for memory leak
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four_mat_mul_reverse.cpp}
@@ -204,6 +204,21 @@ bool reverse(void)
     };
     for(size_t ij = 0; ij < nx * nx; ij++)
         ok &= H_0[ij] == check_H_0[ij];
+    //
+    // dw2
+    // Second order reverse mode with weight on the zero order coefficient
+    // of f_0 (x); i.e., first order derivative of f_0 (x).
+    CPPAD_TESTVECTOR(double) w02(2 * ny);
+    for(size_t i = 0; i < 2 * ny; ++i)
+        w02[i] = 0.0;
+    w02[0 * 2 + 0] = 1.0;
+    x1[0] = 1.0;
+    f.Forward(1, x1);
+    dw2 = f.Reverse(2, w02);
+    for(size_t j = 0; j < nx; ++j)
+    {   ok &= dw2[2 * j + 0] == check_J[0 * nx + j];
+        ok &= dw2[2 * j + 1] == 0.0;
+    }
     // -----------------------------------------------------------------------
     // Record g
     // -----------------------------------------------------------------------
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin atomic_four_thread_work.cpp}
+
+Atomic Function Work Space for Each Thread: Example and Test
+############################################################
+
+Function
+********
+This example uses :ref:`atomic_four_thread_work-name`
+to define the operation
+:math:`g : \B{R}^n \rightarrow \B{R}` where
+
+.. math::
+
+    g(x) =  x_0^2 + \cdots + x_{n-1}^2
+
+Purpose
+*******
+The forward and reverse callbacks use a temporary vector
+that is stored in the work space for the current thread.
+Hence one atomic function object can be used by multiple threads
+without locking and without a copy of the object for each thread.
+
+Threads
+*******
+In order to have a deterministic test, this example
+simulates multiple threads by changing the thread number
+in sequential code.
+See :ref:`thread_alloc-name` for an example that uses the
+actual threads.
+
+Define Atomic Function
+**********************
+{xrst_literal
+    // BEGIN_DEFINE_ATOMIC_FUNCTION
+    // END_DEFINE_ATOMIC_FUNCTION
+}
+
+Use Atomic Function
+*******************
+{xrst_literal
+    // BEGIN_USE_ATOMIC_FUNCTION
+    // END_USE_ATOMIC_FUNCTION
+}
+
+{xrst_end atomic_four_thread_work.cpp}
+*/
+# include <cppad/cppad.hpp>
+
+// BEGIN_DEFINE_ATOMIC_FUNCTION
+// empty namespace
+namespace {
+    //
+    // thread_work_struct
+    // work space used by each thread
+    struct thread_work_struct {
+        // number of callbacks that used this work space
+        size_t                n_callback;
+        // temporary vector used by the callbacks
+        CppAD::vector<double> x_sq;
+        //
+        thread_work_struct(void) : n_callback(0)
+        { }
+    };
+    //
+    class atomic_thread_work : public CppAD::atomic_four<double> {
+    public:
+        atomic_thread_work(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        { }
+        //
+        // work
+        // access the work space for the current thread
+        thread_work_struct& work(void)
+        {   return this->template thread_work<thread_work_struct>(); }
+    private:
+        // for_type
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   assert( call_id == 0 );       // default value
+            assert(type_y.size() == 1 );  // m
+            //
+            // type_y
+            size_t n     = type_x.size();
+            type_y[0] = CppAD::constant_enum;
+            for(size_t j = 0; j < n; ++j)
+                type_y[0] = std::max(type_y[0], type_x[j]);
+            return true;
+        }
+        // forward
+        bool forward(
+            size_t                             call_id     ,
+            const CppAD::vector<bool>&         select_y    ,
+            size_t                             order_low   ,
+            size_t                             order_up    ,
+            const CppAD::vector<double>&       tx          ,
+            CppAD::vector<double>&             ty          ) override
+        {   assert( call_id == 0 );
+            //
+            // ok
+            bool ok = order_up == 0;
+            if( ! ok )
+                return ok;
+            //
+            // work
+            thread_work_struct& work = this->work();
+            ++work.n_callback;
+            //
+            // work.x_sq
+            size_t n = tx.size();
+            work.x_sq.resize(n);
+            for(size_t j = 0; j < n; ++j)
+                work.x_sq[j] = tx[j] * tx[j];
+            //
+            // ty
+            ty[0] = 0.0;
+            for(size_t j = 0; j < n; ++j)
+                ty[0] += work.x_sq[j];
+            //
+            return ok;
+        }
+        // reverse
+        bool reverse(
+            size_t                              call_id     ,
+            const CppAD::vector<bool>&          select_x    ,
+            size_t                              order_up    ,
+            const CppAD::vector<double>&        tx          ,
+            const CppAD::vector<double>&        ty          ,
+            CppAD::vector<double>&              px          ,
+            const CppAD::vector<double>&        py          ) override
+        {   assert( call_id == 0 );
+            //
+            // ok
+            bool ok = order_up == 0;
+            if( ! ok )
+                return ok;
+            //
+            // work
+            thread_work_struct& work = this->work();
+            ++work.n_callback;
+            //
+            // work.x_sq
+            // use x_sq to hold the partial of g w.r.t x
+            size_t n = tx.size();
+            work.x_sq.resize(n);
+            for(size_t j = 0; j < n; ++j)
+                work.x_sq[j] = 2.0 * tx[j];
+            //
+            // px
+            for(size_t j = 0; j < n; ++j)
+                px[j] = py[0] * work.x_sq[j];
+            //
+            return ok;
+        }
+    };
+}
+// END_DEFINE_ATOMIC_FUNCTION
+
+// BEGIN_USE_ATOMIC_FUNCTION
+namespace {
+    //
+    // thread_number_, in_parallel_
+    // simulated thread number and parallel mode
+    size_t thread_number_ = 0;
+    bool   in_parallel_   = false;
+    //
+    // in_parallel
+    bool in_parallel(void)
+    {   return in_parallel_; }
+    //
+    // thread_number
+    size_t thread_number(void)
+    {   return thread_number_; }
+}
+bool thread_work(void)
+{   // ok, eps
+    bool ok    = true;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    // AD
+    using CppAD::AD;
+    //
+    // afun
+    // a single atomic function object used by all the threads
+    atomic_thread_work afun("atomic_thread_work");
+    //
+    // num_threads
+    size_t num_threads = 3;
+    //
+    // parallel_setup, parallel_ad
+    CppAD::thread_alloc::parallel_setup(
+        num_threads, in_parallel, thread_number
+    );
+    CppAD::parallel_ad<double>();
+    //
+    // n, m
+    size_t n = 3;
+    size_t m = 1;
+    //
+    // in_parallel_
+    in_parallel_ = true;
+    //
+    // work_ptr, n_callback
+    // work space address and number of callbacks for each thread
+    CppAD::vector<thread_work_struct*> work_ptr(num_threads);
+    CppAD::vector<size_t>       n_callback(num_threads);
+    //
+    // thread_number_
+    // Each simulated thread records and evaluates its own ADFun object.
+    for(thread_number_ = 0; thread_number_ < num_threads; ++thread_number_)
+    {   //
+        // x
+        CPPAD_TESTVECTOR(double) x(n);
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(thread_number_ + j + 1);
+        //
+        // f
+        CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        CppAD::Independent(ax);
+        afun(ax, ay);
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // ok
+        // zero order forward
+        CPPAD_TESTVECTOR(double) y(m);
+        y = f.Forward(0, x);
+        double check = 0.0;
+        for(size_t j = 0; j < n; ++j)
+            check += x[j] * x[j];
+        ok &= CppAD::NearEqual(y[0], check, eps, eps);
+        //
+        // ok
+        // first order reverse
+        CPPAD_TESTVECTOR(double) w(m), dw(n);
+        w[0] = 1.0;
+        dw   = f.Reverse(1, w);
+        for(size_t j = 0; j < n; ++j)
+            ok &= CppAD::NearEqual(dw[j], 2.0 * x[j], eps, eps);
+        //
+        // work_ptr, n_callback
+        work_ptr[thread_number_]   = &afun.work();
+        n_callback[thread_number_] = afun.work().n_callback;
+    }
+    //
+    // ok
+    // each thread has its own work space
+    for(size_t i = 0; i < num_threads; ++i)
+    {   // if the work space were shared, n_callback would increase with i
+        ok &= 0 < n_callback[i];
+        ok &= n_callback[i] == n_callback[0];
+        for(size_t j = i + 1; j < num_threads; ++j)
+            ok &= work_ptr[i] != work_ptr[j];
+    }
+    //
+    // in_parallel_, thread_number_, parallel_setup
+    in_parallel_   = false;
+    thread_number_ = 0;
+    CppAD::thread_alloc::parallel_setup(1, nullptr, nullptr);
+    //
+    return ok;
+}
+// END_USE_ATOMIC_FUNCTION
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin chkpoint_two.cpp}
@@ -44,6 +44,7 @@ extern bool base2ad(void);
 extern bool compare(void);
 extern bool dynamic(void);
 extern bool get_started(void);
+extern bool memo(void);
 extern bool ode(void);
 
 // main program that runs all the tests
@@ -59,6 +60,7 @@ int main(void)
     Run( compare,             "compare"        );
     Run( dynamic,             "dynamic"        );
     Run( get_started,         "get_started"    );
+    Run( memo,                "memo"           );
     Run( ode,                 "ode"            );
     //
     // check for memory leak
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin chkpoint_two_memo.cpp}
+
+Memorize Checkpoint Function Results: Example and Test
+######################################################
+
+Purpose
+*******
+This example demonstrates
+:ref:`memorizing<chkpoint_two_memo-name>` the results for a
+:ref:`chkpoint_two-name` function.
+
+g(x)
+****
+For this example, the checkpoint function
+:math:`g : \B{R}^2 \rightarrow \B{R}^2` is defined by
+
+.. math::
+
+    g(x)
+    =
+    \left( \begin{array}{c}
+        x_0 \cdot x_1 \\
+        x_0 - x_1
+    \end{array} \right)
+
+f(x)
+****
+The function :math:`f(x) : \B{R}^2 \rightarrow \B{R}^2`
+is defined by :math:`f(x) = g(x) + g(x)` where each term is
+a separate use of the checkpoint function.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end chkpoint_two_memo.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool memo(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // record the function g(x)
+    size_t n = 2, m = 2;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m), az(m);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = double(j + 1);
+    Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = ax[0] - ax[1];
+    CppAD::ADFun<double> g_fun(ax, ay);
+    //
+    // make a checkpoint version of g
+    std::string name             = "g(x)";
+    bool        internal_bool    = true;
+    bool        use_hes_sparsity = false;
+    bool        use_base2ad      = false;
+    bool        use_in_parallel  = false;
+    CppAD::chkpoint_two<double> g_chk(g_fun, name,
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    // record f(x) using checkpoint version of g(x)
+    Independent(ax);
+    g_chk(ax, ay);
+    g_chk(ax, az);
+    for(size_t i = 0; i < m; ++i)
+        ay[i] = ay[i] + az[i];
+    CppAD::ADFun<double> f_fun(ax, ay);
+    //
+    // memorize up to four results for g(x)
+    // (this also zeros n_hit and n_miss)
+    g_chk.memo_size(4);
+    size_t n_hit, n_miss;
+    //
+    // x
+    CPPAD_TESTVECTOR(double) x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 3.0 + double(j);
+    //
+    // zero order forward
+    // The second use of g_chk has the same argument as the first.
+    CPPAD_TESTVECTOR(double) y(m);
+    y = f_fun.Forward(0, x);
+    g_chk.memo_count(n_hit, n_miss);
+    ok &= n_hit == 1 && n_miss == 1;
+    //
+    // check zero order forward
+    double check;
+    check = 2.0 * x[0] * x[1];
+    ok   &= NearEqual(check, y[0], eps99, eps99);
+    check = 2.0 * (x[0] - x[1]);
+    ok   &= NearEqual(check, y[1], eps99, eps99);
+    //
+    // first order reverse
+    // Both uses of g_chk have the same argument and partials w.r.t. y.
+    CPPAD_TESTVECTOR(double) w(m), dw(n);
+    w[0] = 1.0;
+    w[1] = 2.0;
+    dw   = f_fun.Reverse(1, w);
+    g_chk.memo_count(n_hit, n_miss);
+    ok &= n_hit == 2 && n_miss == 2;
+    //
+    // repeat the reverse pass: both uses of g_chk are memorized
+    dw   = f_fun.Reverse(1, w);
+    g_chk.memo_count(n_hit, n_miss);
+    ok &= n_hit == 4 && n_miss == 2;
+    //
+    // check first order reverse
+    check = 2.0 * ( w[0] * x[1] + w[1] );
+    ok   &= NearEqual(check, dw[0], eps99, eps99);
+    check = 2.0 * ( w[0] * x[0] - w[1] );
+    ok   &= NearEqual(check, dw[1], eps99, eps99);
+    //
+    // a new argument value is not memorized
+    x[0] = 5.0;
+    y    = f_fun.Forward(0, x);
+    g_chk.memo_count(n_hit, n_miss);
+    ok &= n_hit == 5 && n_miss == 3;
+    check = 2.0 * x[0] * x[1];
+    ok   &= NearEqual(check, y[0], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin atomic_parallel.cpp}
+
+Batches of Independent Atomic Function Calls: Example and Test
+##############################################################
+
+Atomic Function
+***************
+This example uses the atomic function :math:`g(u) = u^2` .
+
+f(x)
+****
+The function :math:`f : \B{R}^3 \rightarrow \B{R}^2` is defined by
+
+.. math::
+
+    s(x) & = g( x_0 ) + g( x_1 ) + g( x_2 )
+    \\
+    f(x) & = \left( \begin{array}{c}
+        g[ s(x) ] \\
+        g \{ g[ s(x) ] \}
+    \end{array} \right)
+
+The first three calls to :math:`g` are independent of each other
+and are evaluated in one batch.
+Each of the other calls depends on the previous call and is evaluated
+by itself.
+
+par_for
+*******
+This example does not use multiple threads.
+The :ref:`atomic_parallel@par_for` function used here
+records the number of tasks and then executes them in reverse order;
+i.e., it checks that the order does not matter.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end atomic_parallel.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    //
+    // atomic_square
+    class atomic_square : public CppAD::atomic_four<double> {
+    public:
+        atomic_square(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        { }
+    private:
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   type_y[0] = type_x[0];
+            return true;
+        }
+        bool forward(
+            size_t                             call_id     ,
+            const CppAD::vector<bool>&         select_y    ,
+            size_t                             order_low   ,
+            size_t                             order_up    ,
+            const CppAD::vector<double>&       tx          ,
+            CppAD::vector<double>&             ty          ) override
+        {   if( order_up != 0 )
+                return false;
+            ty[0] = tx[0] * tx[0];
+            return true;
+        }
+    };
+    //
+    // n_task_list_
+    // the value of n_task for each call to par_for
+    CppAD::vector<size_t> n_task_list_;
+    //
+    // par_for
+    void par_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   n_task_list_.push_back(n_task);
+        for(size_t i = 0; i < n_task; ++i)
+            task(n_task - i - 1, info);
+    }
+}
+
+bool atomic_parallel(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // g
+    atomic_square g("atomic_square");
+    //
+    // f
+    size_t n = 3, m = 2;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m), au(1), av(1), aw(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    for(size_t j = 0; j < n; ++j)
+    {   au[0] = ax[j];
+        g(au, av);
+        aw[j] = av[0];
+    }
+    AD<double> as = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        as += aw[j];
+    au[0] = as;
+    g(au, av);
+    ay[0] = av[0];
+    au[0] = av[0];
+    g(au, av);
+    ay[1] = av[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // f.atomic_parallel
+    ok &= f.atomic_parallel() == nullptr;
+    f.atomic_parallel(par_for);
+    ok &= f.atomic_parallel() == par_for;
+    //
+    // y
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 0.5 * double(j + 1);
+    n_task_list_.clear();
+    y = f.Forward(0, x);
+    //
+    // ok
+    double s = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        s += x[j] * x[j];
+    double check = s * s;
+    ok &= NearEqual(y[0], check, eps99, eps99);
+    check = check * check;
+    ok &= NearEqual(y[1], check, eps99, eps99);
+    //
+    // ok
+    // only the first three calls to g are evaluated using par_for
+    ok &= n_task_list_.size() == 1;
+    if( n_task_list_.size() == 1 )
+        ok &= n_task_list_[0] == 3;
+    //
+    // n_task_list_
+    // free its memory so it is not reported as a leak
+    n_task_list_.clear();
+    //
+    return ok;
+}
+// END C++
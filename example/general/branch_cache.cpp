@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin branch_cache.cpp}
+
+Cache of Recordings for Different Comparison Results: Example and Test
+######################################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end branch_cache.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::AD;
+    //
+    // piecewise_cache
+    // f(x) = x_0 * x_1 if x_0 < x_1, x_0 + x_1 otherwise
+    class piecewise_cache : public CppAD::branch_cache<double> {
+    public:
+        piecewise_cache(size_t max_size)
+        : CppAD::branch_cache<double>(max_size)
+        { }
+        void algo(const ADVector& ax, ADVector& ay) override
+        {   ay.resize(1);
+            if( ax[0] < ax[1] )
+                ay[0] = ax[0] * ax[1];
+            else
+                ay[0] = ax[0] + ax[1];
+        }
+    };
+}
+
+bool branch_cache(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // cache
+    size_t max_size = 2;
+    piecewise_cache cache(max_size);
+    //
+    // x, y
+    size_t n = 2;
+    CPPAD_TESTVECTOR(double) x(n), y(1), dy(n);
+    //
+    // first branch: a new recording is required
+    x[0] = 1.0;
+    x[1] = 2.0;
+    y    = cache.forward(x);
+    ok  &= NearEqual(y[0], x[0] * x[1], eps99, eps99);
+    ok  &= cache.n_miss() == 1 && cache.n_hit() == 0;
+    //
+    // second branch: a new recording is required
+    x[0] = 3.0;
+    y    = cache.forward(x);
+    ok  &= NearEqual(y[0], x[0] + x[1], eps99, eps99);
+    ok  &= cache.n_miss() == 2 && cache.n_hit() == 0;
+    ok  &= cache.size() == 2;
+    //
+    // first branch again: the first recording is used
+    x[0] = 0.5;
+    x[1] = 4.0;
+    y    = cache.forward(x);
+    ok  &= NearEqual(y[0], x[0] * x[1], eps99, eps99);
+    ok  &= cache.n_miss() == 2 && cache.n_hit() == 1;
+    //
+    // derivative using the recording for the first branch
+    dy   = cache.fun().Jacobian(x);
+    ok  &= NearEqual(dy[0], x[1], eps99, eps99);
+    ok  &= NearEqual(dy[1], x[0], eps99, eps99);
+    //
+    // second branch again: the second recording is used
+    x[0] = 5.0;
+    y    = cache.forward(x);
+    ok  &= NearEqual(y[0], x[0] + x[1], eps99, eps99);
+    ok  &= cache.n_miss() == 2 && cache.n_hit() == 2;
+    dy   = cache.fun().Jacobian(x);
+    ok  &= NearEqual(dy[0], 1.0, eps99, eps99);
+    ok  &= NearEqual(dy[1], 1.0, eps99, eps99);
+    //
+    // clear
+    cache.clear();
+    ok &= cache.size() == 0 && cache.n_hit() == 0 && cache.n_miss() == 0;
+    //
+    return ok;
+}
+// END C++
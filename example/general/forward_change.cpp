@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin forward_change.cpp}
+
+Zero Order Forward When Some Independent Variables Change: Example and Test
+###########################################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end forward_change.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool forward_change(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f
+    // f_i(x) = sin( x_i ) * x_{i+1} for i = 0, ..., n-2
+    // f_{n-1}(x) = x_0 + ... + x_{n-1}
+    size_t n = 10, m = n;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    AD<double> asum = 0.0;
+    for(size_t i = 0; i < n - 1; ++i)
+        ay[i] = sin( ax[i] ) * ax[i+1];
+    for(size_t j = 0; j < n; ++j)
+        asum += ax[j];
+    ay[n-1] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, y
+    // zero order forward at the initial point
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 1.0 / double(j + 1);
+    y = f.Forward(0, x);
+    //
+    // change, work
+    // only x_3 changes
+    CPPAD_TESTVECTOR(size_t) change(1);
+    change[0] = 3;
+    CppAD::forward_change_work work;
+    //
+    // coordinate descent style loop
+    for(size_t k = 0; k < 5; ++k)
+    {   //
+        // y
+        // only the operators that depend on x_3 are evaluated
+        x[3] = 0.5 + double(k);
+        y    = f.forward_change(x, change, work);
+        //
+        // ok
+        double sum = 0.0;
+        for(size_t j = 0; j < n; ++j)
+            sum += x[j];
+        for(size_t i = 0; i < n - 1; ++i)
+        {   double check = std::sin( x[i] ) * x[i+1];
+            ok &= NearEqual(y[i], check, eps99, eps99);
+        }
+        ok &= NearEqual(y[n-1], sum, eps99, eps99);
+    }
+    //
+    // ok
+    // the zero order Taylor coefficients correspond to x
+    ok &= f.size_order() == 1;
+    CPPAD_TESTVECTOR(double) dx(n), dy(m);
+    for(size_t j = 0; j < n; ++j)
+        dx[j] = 0.0;
+    dx[3] = 1.0;
+    dy    = f.Forward(1, dx);
+    ok   &= NearEqual(dy[2], std::sin( x[2] ), eps99, eps99);
+    ok   &= NearEqual(dy[3], std::cos( x[3] ) * x[4], eps99, eps99);
+    ok   &= NearEqual(dy[n-1], 1.0, eps99, eps99);
+    //
+    return ok;
+}
+// END C++
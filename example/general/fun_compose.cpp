@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin fun_compose.cpp}
+
+Compose Two Functions: Example and Test
+#######################################
+
+Functions
+*********
+The inner function is
+:math:`f(x) = [ x_0 x_1 , p \sin( x_0 ) , \exp( x_1 ) ]`
+where :math:`p` is a dynamic parameter.
+The outer function is
+:math:`g(u) = [ u_0 + q u_1 , u_0 u_1 ]`
+where :math:`q` is a dynamic parameter.
+The composition :math:`h(x) = g[ f(x) ]` does not depend on
+:math:`f_2 (x)` , so optimizing *h* removes the corresponding operations.
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end fun_compose.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool fun_compose(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f
+    vector< AD<double> > ax(2), ap(1), ay(3);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    ap[0] = 2.0;
+    CppAD::Independent(ax, ap);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = ap[0] * sin( ax[0] );
+    ay[2] = exp( ax[1] );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    vector< AD<double> > au(3), aq(1), az(2);
+    for(size_t j = 0; j < 3; ++j)
+        au[j] = double(j + 1);
+    aq[0] = 3.0;
+    CppAD::Independent(au, aq);
+    az[0] = au[0] + aq[0] * au[1];
+    az[1] = au[0] * au[1];
+    CppAD::ADFun<double> g(au, az);
+    //
+    // h
+    CppAD::ADFun<double> h;
+    h.compose(g, f);
+    ok &= h.Domain() == 2;
+    ok &= h.Range() == 2;
+    ok &= h.size_dyn_ind() == 2;
+    ok &= h.size_order() == 0;
+    //
+    // check_h
+    // check h(x) and its Jacobian at x with the dynamic parameters p and q
+    auto check_h = [&](const vector<double>& x, double p, double q)
+    {   bool ok_h = true;
+        vector<double> z  = h.Forward(0, x);
+        vector<double> dz = h.Jacobian(x);
+        double u0 = x[0] * x[1];
+        double u1 = p * sin( x[0] );
+        ok_h &= NearEqual(z[0], u0 + q * u1, eps99, eps99);
+        ok_h &= NearEqual(z[1], u0 * u1, eps99, eps99);
+        //
+        // dz[i * n + j] is partial of z[i] w.r.t. x[j]
+        double du1_dx0 = p * cos( x[0] );
+        ok_h &= NearEqual(dz[0], x[1] + q * du1_dx0, eps99, eps99);
+        ok_h &= NearEqual(dz[1], x[0], eps99, eps99);
+        ok_h &= NearEqual(dz[2], x[1] * u1 + u0 * du1_dx0, eps99, eps99);
+        ok_h &= NearEqual(dz[3], x[0] * u1, eps99, eps99);
+        return ok_h;
+    };
+    //
+    // x
+    vector<double> x = {0.5, 2.0};
+    //
+    // the dynamic parameter values in h are their values in f and g
+    ok &= check_h(x, 2.0, 3.0);
+    //
+    // change the dynamic parameters
+    vector<double> p = {4.0, 5.0};
+    h.new_dynamic(p);
+    ok &= check_h(x, 4.0, 5.0);
+    //
+    // optimize the composition
+    // The operations used to compute f_2 (x) are removed.
+    size_t size_var = h.size_var();
+    h.optimize();
+    ok &= h.size_var() < size_var;
+    ok &= check_h(x, 4.0, 5.0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin fun_splice.cpp}
+
+Splice Functions Together: Example and Test
+###########################################
+
+Pieces
+******
+The first piece is :math:`f_0 ( x_0 , x_1 ) = p_0 \sin( x_0 ) x_1`
+where :math:`p_0` is a dynamic parameter.
+The second piece uses a conditional expression and a :ref:`VecAD-name`
+vector to compute
+:math:`f_1 ( x_1 , x_2 ) = ( | x_1 | + v( x_2 ) , x_1 x_2 + 2 )`
+where :math:`v(0) = 3` and :math:`v(1) = 4` .
+The pieces share the variable :math:`x_1`
+and they are spliced together to form
+:math:`h(x) = [ f_0 ( x_0 , x_1 ) , f_1 ( x_1 , x_2 ) ]` .
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end fun_splice.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::AD;
+    using CppAD::vector;
+    //
+    // record_f0
+    void record_f0(CppAD::ADFun<double>& f0)
+    {   vector< AD<double> > ax(2), ay(1), ap(1);
+        ax[0] = 0.5;
+        ax[1] = 1.5;
+        ap[0] = 2.0;
+        CppAD::Independent(ax, ap);
+        ay[0] = ap[0] * sin( ax[0] ) * ax[1];
+        f0.Dependent(ax, ay);
+    }
+    //
+    // record_f1
+    void record_f1(CppAD::ADFun<double>& f1)
+    {   vector< AD<double> > ax(2), ay(2);
+        ax[0] = 1.5;
+        ax[1] = 1.0;
+        CppAD::Independent(ax);
+        //
+        CppAD::VecAD<double> av(2);
+        av[ AD<double>(0) ] = 3.0;
+        av[ AD<double>(1) ] = 4.0;
+        //
+        AD<double> zero(0.0);
+        AD<double> abs_x1 = CondExpGe(ax[0], zero, ax[0], - ax[0]);
+        ay[0] = abs_x1 + av[ ax[1] ];
+        ay[1] = ax[0] * ax[1] + 2.0;
+        f1.Dependent(ax, ay);
+    }
+}
+
+bool fun_splice(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // fun_vec
+    // The pieces could be recorded using a different thread for each piece.
+    std::vector< CppAD::ADFun<double> > fun_vec(2);
+    record_f0( fun_vec[0] );
+    record_f1( fun_vec[1] );
+    //
+    // var_index, dyn_index
+    // h(x) = [ f_0(x_0, x_1) , f_1(x_1, x_2) ]
+    vector<size_t> var_index = {0, 1, 1, 2};
+    vector<size_t> dyn_index = {0};
+    //
+    // h
+    CppAD::ADFun<double> h;
+    h.splice(fun_vec, var_index, dyn_index);
+    ok &= h.Domain() == 3;
+    ok &= h.Range() == 3;
+    ok &= h.size_dyn_ind() == 1;
+    ok &= h.size_order() == 0;
+    //
+    // check_h
+    // check h(x) and its Jacobian at x with the dynamic parameter p
+    auto check_h = [&](const vector<double>& x, double p)
+    {   bool ok_h = true;
+        vector<double> y  = h.Forward(0, x);
+        vector<double> dy = h.Jacobian(x);
+        double abs_x1 = x[1] >= 0.0 ? x[1] : - x[1];
+        double v_x2   = x[2] < 1.0 ? 3.0 : 4.0;
+        ok_h &= NearEqual(y[0], p * sin(x[0]) * x[1], eps99, eps99);
+        ok_h &= NearEqual(y[1], abs_x1 + v_x2, eps99, eps99);
+        ok_h &= NearEqual(y[2], x[1] * x[2] + 2.0, eps99, eps99);
+        //
+        // dy[i * n + j] is partial of y[i] w.r.t. x[j]
+        ok_h &= NearEqual(dy[0], p * cos(x[0]) * x[1], eps99, eps99);
+        ok_h &= NearEqual(dy[1], p * sin(x[0]), eps99, eps99);
+        ok_h &= dy[2] == 0.0;
+        ok_h &= dy[3] == 0.0;
+        ok_h &= dy[4] == (x[1] >= 0.0 ? 1.0 : -1.0);
+        ok_h &= dy[5] == 0.0;
+        ok_h &= dy[6] == 0.0;
+        ok_h &= NearEqual(dy[7], x[2], eps99, eps99);
+        ok_h &= NearEqual(dy[8], x[1], eps99, eps99);
+        return ok_h;
+    };
+    //
+    // x
+    vector<double> x = {0.5, -1.5, 1.0};
+    //
+    // the dynamic parameter value in h is its value in f_0
+    ok &= check_h(x, 2.0);
+    //
+    // change the dynamic parameter
+    vector<double> p = {3.0};
+    h.new_dynamic(p);
+    ok &= check_h(x, 3.0);
+    //
+    // optimize the spliced function
+    h.optimize();
+    x[1] = 2.0;
+    x[2] = 0.0;
+    ok &= check_h(x, 3.0);
+    //
+    return ok;
+}
+// END C++
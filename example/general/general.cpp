@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin general.cpp}
@@ -62,6 +62,7 @@ extern bool HesLagrangian(void);
 extern bool HesLuDet(void);
 extern bool HesMinorDet(void);
 extern bool HesTimesDir(void);
+extern bool hes_vec_batch(void);
 extern bool Hessian(void);
 extern bool Independent(void);
 extern bool Integer(void);
@@ -101,10 +102,12 @@ extern bool asinh(void);
 extern bool atan(void);
 extern bool atan2(void);
 extern bool atanh(void);
+extern bool atomic_parallel(void);
 extern bool azmul(void);
 extern bool base2ad(void);
 extern bool base2vec_ad(void);
 extern bool base_require(void);
+extern bool branch_cache(void);
 extern bool capacity_order(void);
 extern bool change_param(void);
 extern bool check_for_nan(void);
@@ -117,10 +120,13 @@ extern bool erfc(void);
 extern bool exp(void);
 extern bool expm1(void);
 extern bool fabs(void);
+extern bool forward_change(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
 extern bool fun_assign(void);
+extern bool fun_compose(void);
 extern bool fun_property(void);
+extern bool fun_splice(void);
 extern bool function_name(void);
 extern bool interp_onetape(void);
 extern bool interp_retape(void);
@@ -128,6 +134,7 @@ extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
 extern bool lu_vec_ad_ok(void);
+extern bool memory_report(void);
 extern bool mul_level(void);
 extern bool mul_level_adolc(void);
 extern bool mul_level_adolc_ode(void);
@@ -141,10 +148,13 @@ extern bool pow(void);
 extern bool pow_nan(void);
 extern bool print_for(void);
 extern bool rev_checkpoint(void);
+extern bool reverse_dir(void);
 extern bool reverse_one(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
+extern bool revolve_reverse(void);
 extern bool sign(void);
+extern bool sweep_profile(void);
 extern bool taylor_ode(void);
 extern bool unary_minus(void);
 extern bool unary_plus(void);
@@ -179,6 +189,7 @@ int main(void)
     Run( HesLuDet,          "HesLuDet"         );
     Run( HesMinorDet,       "HesMinorDet"      );
     Run( HesTimesDir,       "HesTimesDir"      );
+    Run( hes_vec_batch,     "hes_vec_batch"    );
     Run( Hessian,           "Hessian"          );
     Run( Independent,       "Independent"      );
     Run( Integer,           "Integer"          );
@@ -218,10 +229,12 @@ int main(void)
     Run( atan,              "atan"             );
     Run( atan2,             "atan2"            );
     Run( atanh,             "atanh"            );
+    Run( atomic_parallel,   "atomic_parallel"  );
     Run( azmul,             "azmul"            );
     Run( base2ad,           "base2ad"          );
     Run( base2vec_ad,       "base2vec_ad"      );
     Run( base_require,      "base_require"     );
+    Run( branch_cache,      "branch_cache"     );
     Run( capacity_order,    "capacity_order"   );
     Run( change_param,      "change_param"     );
     Run( complex_poly,      "complex_poly"     );
@@ -231,10 +244,13 @@ int main(void)
     Run( exp,               "exp"              );
     Run( expm1,             "expm1"            );
     Run( fabs,              "fabs"             );
+    Run( forward_change,    "forward_change"   );
     Run( forward_dir,       "forward_dir"      );
     Run( forward_order,     "forward_order"    );
     Run( fun_assign,        "fun_assign"       );
+    Run( fun_compose,       "fun_compose"      );
     Run( fun_property,      "fun_property"     );
+    Run( fun_splice,        "fun_splice"       );
     Run( function_name,     "function_name"    );
     Run( interp_onetape,    "interp_onetape"   );
     Run( interp_retape,     "interp_retape"    );
@@ -242,6 +258,7 @@ int main(void)
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
     Run( lu_vec_ad_ok,      "lu_vec_ad_ok"     );
+    Run( memory_report,     "memory_report"    );
     Run( mul_level,         "mul_level"        );
     Run( mul_level_ode,     "mul_level_ode"    );
     Run( near_equal_ext,    "near_equal_ext"   );
@@ -252,10 +269,13 @@ int main(void)
     Run( pow,               "pow"              );
     Run( pow_nan,           "pow_nan"          );
     Run( rev_checkpoint,    "rev_checkpoint"   );
+    Run( reverse_dir,       "reverse_dir"      );
     Run( reverse_one,       "reverse_one"      );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
+    Run( revolve_reverse,   "revolve_reverse"  );
     Run( sign,              "sign"             );
+    Run( sweep_profile,     "sweep_profile"    );
     Run( taylor_ode,        "ode_taylor"       );
     Run( unary_minus,       "unary_minus"      );
     Run( unary_plus,        "unary_plus"       );
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin hes_vec_batch.cpp}
+
+Hessian Times a Batch of Vectors: Example and Test
+##################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end hes_vec_batch.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool hes_vec_batch(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f
+    // f_0(x) = x_0 * x_1 * x_2
+    // f_1(x) = sin(x_0) + x_1 * exp(x_2)
+    size_t n = 3, m = 2;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = sin( ax[0] ) + ax[1] * exp( ax[2] );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, w, r, v, hv, work
+    CPPAD_TESTVECTOR(double) x(n), w(m), v, hv;
+    w[0] = 2.0;
+    w[1] = 3.0;
+    size_t r = 0;
+    CppAD::hes_vec_work<double> work;
+    //
+    // check_hv
+    // check hv = H(x) V where H(x) is the Hessian of w^T f(x)
+    auto check_hv = [&](void)
+    {   CPPAD_TESTVECTOR(double) hes(n * n);
+        double e2 = std::exp( x[2] );
+        hes[0 * n + 0] = - w[1] * std::sin( x[0] );
+        hes[0 * n + 1] = w[0] * x[2];
+        hes[0 * n + 2] = w[0] * x[1];
+        hes[1 * n + 0] = hes[0 * n + 1];
+        hes[1 * n + 1] = 0.0;
+        hes[1 * n + 2] = w[0] * x[0] + w[1] * e2;
+        hes[2 * n + 0] = hes[0 * n + 2];
+        hes[2 * n + 1] = hes[1 * n + 2];
+        hes[2 * n + 2] = w[1] * x[1] * e2;
+        bool ok_hv = hv.size() == n * r;
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t ell = 0; ell < r; ++ell)
+            {   double check = 0.0;
+                for(size_t j = 0; j < n; ++j)
+                    check += hes[i * n + j] * v[r * j + ell];
+                ok_hv &= NearEqual(hv[r * i + ell], check, eps99, eps99);
+            }
+        }
+        return ok_hv;
+    };
+    //
+    // ok
+    // first call, one vector, x is the point where f was recorded
+    // (the zero order coefficients for this x are already in f)
+    r = 1;
+    v.resize(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j] = double(j + 1);
+        v[j] = 1.0;
+    }
+    f.hes_vec_batch(x, w, v, hv, work);
+    ok &= check_hv();
+    //
+    // v
+    // r = 2 vectors stored as the columns of an n by r matrix
+    r = 2;
+    v.resize(n * r);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = 0.5 * double(j + 1);
+        v[r * j + 0] = double(j + 1);
+        v[r * j + 1] = double(j) - 1.0;
+    }
+    //
+    // hv
+    f.hes_vec_batch(x, w, v, hv, work);
+    ok &= check_hv();
+    //
+    // ok
+    // same point and different vectors (zero order forward is not repeated)
+    for(size_t j = 0; j < n; ++j)
+        v[r * j + 1] = double(j * j);
+    f.hes_vec_batch(x, w, v, hv, work);
+    ok &= check_hv();
+    //
+    // ok
+    // reuse work at a different point
+    x[0] = -1.0;
+    f.hes_vec_batch(x, w, v, hv, work);
+    ok &= check_hv();
+    //
+    // ok
+    // one vector
+    r = 1;
+    v.resize(n);
+    for(size_t j = 0; j < n; ++j)
+        v[j] = double(j) + 0.5;
+    f.hes_vec_batch(x, w, v, hv, work);
+    ok &= check_hv();
+    //
+    return ok;
+}
+// END C++
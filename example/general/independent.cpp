@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 WARNING: This file is used an an example by fun_construct.
@@ -84,6 +84,38 @@ bool Test(void)
 
     return ok;
 }
+// retape using the size of a previous recording as a reserve hint
+bool Reserve(void)
+{   bool ok = true;
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR( AD<double> ) ADVector;
+    //
+    // f
+    size_t n = 2, m = 1;
+    ADVector ax(n), ay(m), adynamic(0);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] + ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    // the same algorithm recorded at a different argument value
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    size_t reserve        = f.size_op();
+    ax[0] = 3.0;
+    ax[1] = 4.0;
+    CppAD::Independent(ax, abort_op_index, record_compare, adynamic, reserve);
+    ay[0] = ax[0] * ax[1] + ax[0];
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // ok
+    ok &= g.size_op() == f.size_op();
+    ok &= Value( ay[0] ) == 3.0 * 4.0 + 3.0;
+    //
+    return ok;
+}
 } // End of empty namespace -------------------------------------------
 
 # include <vector>
@@ -96,6 +128,9 @@ bool Independent(void)
     ok &= Test< CppAD::vector  <ADdouble> >();
     ok &= Test< std::vector    <ADdouble> >();
     ok &= Test< std::valarray  <ADdouble> >();
+    //
+    // Independent with a reserve hint
+    ok &= Reserve();
     return ok;
 }
 
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin memory_report.cpp}
+
+Memory Used by Each Part of an ADFun Object: Example and Test
+#############################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end memory_report.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // bytes
+    // number of bytes in report for the specified name
+    // (size_t max if the name is not in report)
+    size_t bytes(
+        const CppAD::vector<CppAD::memory_report_record>& report ,
+        const std::string&                                name   )
+    {   for(size_t i = 0; i < report.size(); ++i)
+        {   if( report[i].name == name )
+                return report[i].bytes;
+        }
+        return std::numeric_limits<size_t>::max();
+    }
+}
+
+bool memory_report(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f
+    size_t n = 2, m = 1;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] + sin( ax[0] );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // report
+    CppAD::vector<CppAD::memory_report_record> report = f.memory_report();
+    //
+    // ok
+    // the operator arguments are stored using tape_addr_type
+    size_t var_arg = bytes(report, "var_arg");
+    ok &= var_arg != std::numeric_limits<size_t>::max();
+    ok &= var_arg >= f.size_op_arg() * sizeof(CppAD::addr_t);
+    //
+    // ok
+    // there is one parameter value for each parameter in the recording
+    size_t par_all = bytes(report, "par_all");
+    ok &= par_all != std::numeric_limits<size_t>::max();
+    ok &= par_all >= f.size_par() * sizeof(double);
+    //
+    // ok
+    // first order forward mode increases the memory for Taylor coefficients
+    size_t taylor = bytes(report, "taylor");
+    ok &= taylor >= f.size_var() * sizeof(double);
+    CPPAD_TESTVECTOR(double) x(n), dx(n);
+    x[0]  = 0.5;
+    x[1]  = 1.5;
+    dx[0] = 1.0;
+    dx[1] = 0.0;
+    f.Forward(0, x);
+    f.Forward(1, dx);
+    report = f.memory_report();
+    ok &= bytes(report, "taylor") >= 2 * f.size_var() * sizeof(double);
+    //
+    // ok
+    // freeing the Taylor coefficients
+    f.capacity_order(0);
+    report = f.memory_report();
+    ok &= bytes(report, "taylor") == 0;
+    //
+    // ok
+    // there are no conditional skip operators in f
+    ok &= bytes(report, "skip_run") == 0;
+    //
+    // g
+    // optimizing a conditional expression creates a conditional skip
+    // operator and the runs of operators that it skips
+    CppAD::Independent(ax);
+    ay[0] = CondExpLt(ax[0], ax[1], sin(ax[0]) * cos(ax[1]), exp(ax[1]));
+    CppAD::ADFun<double> g(ax, ay);
+    g.optimize();
+    ok &= bytes(g.memory_report(), "skip_run") > 0;
+    //
+    // ok
+    // the sweep profile counters are only allocated when profiling
+    ok &= bytes(report, "sweep_profile") == 0;
+    f.sweep_profile(true);
+    f.Forward(0, x);
+    report = f.memory_report();
+    ok &= bytes(report, "sweep_profile") > 0;
+    //
+    return ok;
+}
+// END C++
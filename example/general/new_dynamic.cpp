@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -106,6 +106,20 @@ bool new_dynamic(void)
     ok   &= f.size_order() == 2;
     check = (dynamic[2] + x[1])*(dynamic[0] + 2.0 + x[0] + dynamic[1] + x[0]);
     ok  &= NearEqual(dy[0] , check, eps, eps);
+
+    // change only dynamic[0]; i.e., only recompute the dynamic parameters
+    // that depend on dynamic[0]
+    CPPAD_TESTVECTOR(size_t) change(1);
+    change[0]  = 0;
+    dynamic[0] = 5.0;
+    f.new_dynamic(dynamic, change);
+    ok  &= f.size_order() == 0;
+    //
+    y    = f.Forward(0, x);
+    check  = dynamic[0] + 2.0 + x[0];
+    check *= dynamic[1] + x[0];
+    check *= dynamic[2] + x[1];
+    ok  &= NearEqual(y[0] , check, eps, eps);
     //
     return ok;
 }
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin reverse_dir.cpp}
+
+Multiple Weight Vectors Reverse Mode: Example and Test
+######################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end reverse_dir.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool reverse_dir(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // g_chk
+    // g(u) = [ u_0 * sin(u_1) , u_0 + u_1 ] as a checkpoint function
+    CPPAD_TESTVECTOR( AD<double> ) au(2), av(2);
+    au[0] = 1.0;
+    au[1] = 2.0;
+    CppAD::Independent(au);
+    av[0] = au[0] * sin( au[1] );
+    av[1] = au[0] + au[1];
+    CppAD::ADFun<double> g(au, av);
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = false;
+    CppAD::chkpoint_two<double> g_chk( g, "g_chk",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    // f
+    // f_0(x) = x_0 * x_1 * x_2
+    // f_1(x) = sin(x_0) + x_1 * x_1
+    // f_2(x) = x_2 if x_0 < x_1 and x_1 otherwise
+    // f_3(x) = g_0(x_0, x_2) * x_1 + g_1(x_0, x_2)
+    // The reverse sweep for each weight vector passes through g_chk.
+    size_t n = 3, m = 4;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = sin( ax[0] ) + ax[1] * ax[1];
+    ay[2] = CppAD::CondExpLt(ax[0], ax[1], ax[2], ax[1]);
+    au[0] = ax[0];
+    au[1] = ax[2];
+    g_chk(au, av);
+    ay[3] = av[0] * ax[1] + av[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, dx
+    CPPAD_TESTVECTOR(double) x(n), dx(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = 0.5 * double(j + 1);
+        dx[j] = double(n - j);
+    }
+    f.Forward(0, x);
+    f.Forward(1, dx);
+    //
+    // r, w
+    // weight vectors that are the elementary vectors in R^m
+    size_t r = m;
+    CPPAD_TESTVECTOR(double) w(r * m);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t i = 0; i < m; ++i)
+            w[ell * m + i] = 0.0;
+        w[ell * m + ell] = 1.0;
+    }
+    //
+    // dw
+    // one reverse sweep for all the weight vectors
+    size_t q = 1;
+    CPPAD_TESTVECTOR(double) dw = f.Reverse(q, r, w);
+    ok &= dw.size() == r * n * q;
+    //
+    // ok
+    // with q = 1 the result is the Jacobian of f
+    CPPAD_TESTVECTOR(double) jac = f.Jacobian(x);
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= NearEqual(dw[k], jac[k], eps99, eps99);
+    //
+    // ok
+    // q = 2: same as one call to Reverse for each weight vector
+    q = 2;
+    CPPAD_TESTVECTOR(double) w_ell(m), dw_ell(n * q);
+    dw = f.Reverse(q, r, w);
+    ok &= dw.size() == r * n * q;
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t i = 0; i < m; ++i)
+            w_ell[i] = w[ell * m + i];
+        dw_ell = f.Reverse(q, w_ell);
+        for(size_t k = 0; k < n * q; ++k)
+            ok &= NearEqual(dw[ell * n * q + k], dw_ell[k], eps99, eps99);
+    }
+    //
+    // ok
+    // q = 2 with weights for each order
+    CPPAD_TESTVECTOR(double) wq(r * m * q), wq_ell(m * q);
+    for(size_t k = 0; k < r * m * q; ++k)
+        wq[k] = double(k % 5) - 2.0;
+    dw = f.Reverse(q, r, wq);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t k = 0; k < m * q; ++k)
+            wq_ell[k] = wq[ell * m * q + k];
+        dw_ell = f.Reverse(q, wq_ell);
+        for(size_t k = 0; k < n * q; ++k)
+            ok &= NearEqual(dw[ell * n * q + k], dw_ell[k], eps99, eps99);
+    }
+    //
+    return ok;
+}
+// END C++
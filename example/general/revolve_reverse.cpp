@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin revolve_reverse.cpp}
+
+Binomial Checkpointing Reverse Mode: Example and Test
+#####################################################
+
+Step Function
+*************
+This example uses an Euler step for the pendulum ODE
+
+.. math::
+
+    x_0^\prime (t) = x_1 (t) \W{,} x_1^\prime (t) = - \sin [ x_0 (t) ]
+
+with step size :math:`h`; i.e.,
+
+.. math::
+
+    S(x) = \left( \begin{array}{c}
+        x_0 + h x_1 \\
+        x_1 - h \sin( x_0 )
+    \end{array} \right)
+
+Check
+*****
+The derivative computed by :ref:`revolve_reverse-name`,
+for several memory budgets *n_snap* ,
+is checked using a recording of all the time steps.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end revolve_reverse.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // euler_step
+    template <class Vector>
+    Vector euler_step(const Vector& x, double h)
+    {   Vector y(2);
+        y[0] = x[0] + h * x[1];
+        y[1] = x[1] - h * sin( x[0] );
+        return y;
+    }
+}
+
+bool revolve_reverse(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // n, n_step, h
+    size_t n      = 2;
+    size_t n_step = 100;
+    double h      = 0.01;
+    //
+    // ax
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(n);
+    ax[0] = 1.0;
+    ax[1] = 0.0;
+    //
+    // step
+    // record one time step
+    CppAD::Independent(ax);
+    ay = euler_step(ax, h);
+    CppAD::ADFun<double> step(ax, ay);
+    //
+    // all_step
+    // record all the time steps
+    CppAD::Independent(ax);
+    ay = ax;
+    for(size_t k = 0; k < n_step; ++k)
+        ay = euler_step(ay, h);
+    CppAD::ADFun<double> all_step(ax, ay);
+    //
+    // x_0, w
+    CPPAD_TESTVECTOR(double) x_0(n), w(n);
+    x_0[0] = 0.5;
+    x_0[1] = 0.25;
+    w[0]   = 1.0;
+    w[1]   = 2.0;
+    //
+    // check_x_N, check_dw
+    CPPAD_TESTVECTOR(double) check_x_N(n), check_dw(n);
+    check_x_N = all_step.Forward(0, x_0);
+    check_dw  = all_step.Reverse(1, w);
+    //
+    // n_snap
+    for(size_t n_snap = 0; n_snap < 12; n_snap += 3)
+    {   //
+        // x_N, dw
+        CPPAD_TESTVECTOR(double) x_N(n), dw(n);
+        dw = CppAD::revolve_reverse(step, n_step, n_snap, x_0, w, x_N);
+        //
+        // ok
+        for(size_t j = 0; j < n; ++j)
+        {   ok &= NearEqual(x_N[j], check_x_N[j], eps99, eps99);
+            ok &= NearEqual(dw[j], check_dw[j], eps99, eps99);
+        }
+    }
+    //
+    return ok;
+}
+// END C++
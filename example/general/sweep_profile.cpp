@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin sweep_profile.cpp}
+
+Count and Time the Operators in a Sweep: Example and Test
+#########################################################
+
+Atomic Function
+***************
+This example uses the atomic function :math:`g(u) = u^2` .
+
+f(x)
+****
+The function :math:`f : \B{R}^2 \rightarrow \B{R}^3` is defined by
+
+.. math::
+
+    f(x) = \left( \begin{array}{c}
+        x_0 x_1 \\
+        \sin( x_0 ) \\
+        g( x_1 )
+    \end{array} \right)
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end sweep_profile.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    //
+    // atomic_square
+    class atomic_square : public CppAD::atomic_four<double> {
+    public:
+        atomic_square(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        { }
+    private:
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   type_y[0] = type_x[0];
+            return true;
+        }
+        bool forward(
+            size_t                             call_id     ,
+            const CppAD::vector<bool>&         select_y    ,
+            size_t                             order_low   ,
+            size_t                             order_up    ,
+            const CppAD::vector<double>&       tx          ,
+            CppAD::vector<double>&             ty          ) override
+        {   if( order_up > 1 )
+                return false;
+            if( order_low == 0 )
+                ty[0] = tx[0] * tx[0];
+            if( order_up == 1 )
+                ty[1] = 2.0 * tx[0] * tx[1];
+            return true;
+        }
+        bool reverse(
+            size_t                             call_id     ,
+            const CppAD::vector<bool>&         select_x    ,
+            size_t                             order_up    ,
+            const CppAD::vector<double>&       tx          ,
+            const CppAD::vector<double>&       ty          ,
+            CppAD::vector<double>&             px          ,
+            const CppAD::vector<double>&       py          ) override
+        {   if( order_up != 0 )
+                return false;
+            px[0] = 2.0 * tx[0] * py[0];
+            return true;
+        }
+    };
+    //
+    // find_record
+    // index in report for the specified record (report.size() if not found)
+    size_t find_record(
+        const CppAD::vector<CppAD::sweep_profile_record>& report ,
+        const std::string&                                sweep  ,
+        const std::string&                                name   )
+    {   for(size_t i = 0; i < report.size(); ++i)
+        {   if( report[i].sweep == sweep && report[i].name == name )
+                return i;
+        }
+        return report.size();
+    }
+}
+
+bool sweep_profile(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // g
+    atomic_square g("atomic_square");
+    //
+    // f
+    size_t n = 2, m = 3;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m), au(1), av(1);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = sin( ax[0] );
+    au[0] = ax[1];
+    g(au, av);
+    ay[2] = av[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // f.sweep_profile
+    // turn on profiling
+    f.sweep_profile(true);
+    //
+    // two zero order forward, one first order forward, one reverse sweep
+    CPPAD_TESTVECTOR(double) x(n), dx(n), w(m), dw(n);
+    x[0]  = 0.5;
+    x[1]  = 1.5;
+    f.Forward(0, x);
+    f.Forward(0, x);
+    dx[0] = 1.0;
+    dx[1] = 0.0;
+    f.Forward(1, dx);
+    for(size_t i = 0; i < m; ++i)
+        w[i] = 1.0;
+    dw = f.Reverse(1, w);
+    //
+    // report
+    CppAD::vector<CppAD::sweep_profile_record> report = f.sweep_profile();
+    //
+    // ok
+    // number of times the Mulvv operator was executed during each sweep
+    size_t i = find_record(report, "forward_0", "Mulvv");
+    ok &= i < report.size();
+    if( i < report.size() )
+    {   ok &= report[i].count == 2;
+        ok &= ! report[i].atomic;
+    }
+    i = find_record(report, "forward_any", "Mulvv");
+    ok &= i < report.size();
+    if( i < report.size() )
+        ok &= report[i].count == 1;
+    i = find_record(report, "reverse", "Mulvv");
+    ok &= i < report.size();
+    if( i < report.size() )
+        ok &= report[i].count == 1;
+    //
+    // ok
+    // number of times the atomic function was called during each sweep
+    i = find_record(report, "forward_0", "atomic_square");
+    ok &= i < report.size();
+    if( i < report.size() )
+    {   ok &= report[i].count == 2;
+        ok &= report[i].atomic;
+    }
+    i = find_record(report, "reverse", "atomic_square");
+    ok &= i < report.size();
+    if( i < report.size() )
+        ok &= report[i].count == 1;
+    //
+    // ok
+    // the report is sorted so that seconds is non-increasing
+    for(i = 1; i < report.size(); ++i)
+        ok &= report[i-1].seconds >= report[i].seconds;
+    //
+    // ok
+    // after turning profiling off, the counts do not change
+    f.sweep_profile(false);
+    f.Forward(0, x);
+    CppAD::vector<CppAD::sweep_profile_record> check = f.sweep_profile();
+    ok &= check.size() == report.size();
+    i = find_record(check, "forward_0", "Mulvv");
+    ok &= i < check.size();
+    if( i < check.size() )
+        ok &= check[i].count == 2;
+    //
+    return ok;
+}
+// END C++
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -49,8 +49,8 @@ namespace {
         CppAD::ADFun<double>& f, size_t j, const d_vector& x
     )
     {   // f
-        // This will cause an assert if Taylor coefficients were allocated
-        // by a different thread.
+        // If the Taylor coefficients were allocated by a different thread,
+        // they are put on the remote return list for that thread.
         f.capacity_order(0);
         //
         size_t nx = x.size();
@@ -87,8 +87,8 @@ bool get_started(void)
     fun.Dependent(ax, ay);
 # else
     // This allocates memory for first order Taylor coefficients using thread 0.
-    // An assert will occur at f.capacity_order(0) in run_one_thread when
-    // it is called by a different thread.
+    // This memory is returned to thread 0 by f.capacity_order(0) in partial
+    // when it is called by a different thread.
     CppAD::ADFun<double> fun(ax, ay);
 # endif
     //
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin sparse_hes_edge.cpp}
+
+Sparse Hessian Using Edge Pushing: Example and Test
+###################################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end sparse_hes_edge.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool sparse_hes_edge(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    typedef CPPAD_TESTVECTOR(AD<double>)               a_vector;
+    typedef CPPAD_TESTVECTOR(double)                   d_vector;
+    typedef CPPAD_TESTVECTOR(size_t)                   s_vector;
+    //
+    // f
+    // y_0 = sum_j x_j * x_{j+1} + sin(x_j)
+    // y_1 = x_0 / x_{n-1}
+    size_t n = 6, m = 2;
+    a_vector ax(n), ay(m);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = AD<double>(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; j++)
+    {   ay[0] += sin( ax[j] );
+        if( j + 1 < n )
+            ay[0] += ax[j] * ax[j+1];
+    }
+    ay[1] = ax[0] / ax[n-1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, w
+    d_vector x(n), w(m);
+    for(size_t j = 0; j < n; j++)
+        x[j] = 0.5 * double(j + 1);
+    w[0] = 2.0;
+    w[1] = 3.0;
+    //
+    // subset
+    // the lower triangle of the Hessian
+    size_t nnz = n * (n + 1) / 2;
+    CppAD::sparse_rc<s_vector> pattern(n, n, nnz);
+    size_t k = 0;
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j <= i; ++j)
+            pattern.set(k++, i, j);
+    }
+    CppAD::sparse_rcv<s_vector, d_vector> subset( pattern );
+    //
+    // n_sweep
+    // the edge pushing method does not use pattern or work
+    CppAD::sparse_rc<s_vector> not_used;
+    CppAD::sparse_hes_work     work;
+    std::string coloring = "cppad.edge_push";
+    size_t n_sweep = f.sparse_hes(x, w, subset, not_used, coloring, work);
+    ok &= n_sweep == 1;
+    //
+    // ok
+    d_vector hes = f.Hessian(x, w);
+    const s_vector& row( subset.row() );
+    const s_vector& col( subset.col() );
+    const d_vector& val( subset.val() );
+    for(k = 0; k < nnz; ++k)
+        ok &= NearEqual(val[k], hes[ row[k] * n + col[k] ], eps99, eps99);
+    //
+    // g
+    // same as f except that y_1 = azmul(x_0, x_0 / x_{n-1})
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; j++)
+    {   ay[0] += sin( ax[j] );
+        if( j + 1 < n )
+            ay[0] += ax[j] * ax[j+1];
+    }
+    ay[1] = azmul(ax[0], ax[0] / ax[n-1]);
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // n_sweep
+    // edge pushing does not support azmul, so cppad.symmetric is used.
+    // The Hessian sparsity pattern is computed and stored in work
+    // (pattern is still not used).
+    n_sweep = g.sparse_hes(x, w, subset, not_used, coloring, work);
+    ok &= 1 < n_sweep;
+    //
+    // ok
+    hes = g.Hessian(x, w);
+    for(k = 0; k < nnz; ++k)
+        ok &= NearEqual(val[k], hes[ row[k] * n + col[k] ], eps99, eps99);
+    //
+    // ok
+    // use the work computed by the previous call at a different x
+    x[0] = -1.0;
+    n_sweep = g.sparse_hes(x, w, subset, not_used, coloring, work);
+    hes = g.Hessian(x, w);
+    for(k = 0; k < nnz; ++k)
+        ok &= NearEqual(val[k], hes[ row[k] * n + col[k] ], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -149,6 +149,107 @@ bool type_allocate(void)
     return ok;
 }
 
+// node_num
+// put even threads on node zero and odd threads on node one
+size_t node_num(size_t thread)
+{   return thread % 2; }
+
+bool numa_allocate(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    //
+    // thread
+    size_t thread = thread_alloc::thread_num();
+    ok &= thread == 0;
+    ok &= thread_alloc::free_all();
+    //
+    // numa_setup
+    bool first_touch = true;
+    thread_alloc::numa_setup(first_touch, node_num);
+    ok &= thread_alloc::numa_node(0) == 0;
+    ok &= thread_alloc::numa_node(1) == 1;
+    //
+    // v_ptr
+    // memory that spans more than one page
+    size_t min_bytes = 100000;
+    size_t cap_bytes;
+    void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+    //
+    // ok
+    // thread zero is on node zero
+    ok &= thread_alloc::numa_inuse(0) == thread_alloc::inuse(thread);
+    ok &= thread_alloc::numa_inuse(0) == cap_bytes;
+    ok &= thread_alloc::numa_inuse(1) == 0;
+    //
+    // ok
+    thread_alloc::return_memory(v_ptr);
+    ok &= thread_alloc::numa_inuse(0) == 0;
+    ok &= thread_alloc::numa_available(0) == cap_bytes;
+    ok &= thread_alloc::numa_available(1) == 0;
+    //
+    // return to default NUMA settings
+    thread_alloc::numa_setup(false, nullptr);
+    ok &= thread_alloc::numa_node(1) == 0;
+    //
+    // check that the tests have not held onto memory
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+    //
+    return ok;
+}
+
+bool huge_allocate(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    //
+    // thread
+    size_t thread = thread_alloc::thread_num();
+    ok &= thread_alloc::free_all();
+    //
+    // huge_page
+    // use huge pages for allocations of 1MB or more
+    size_t min_bytes = 1024 * 1024;
+    ok &= thread_alloc::huge_page() == 0;
+    thread_alloc::huge_page(min_bytes);
+    ok &= thread_alloc::huge_page() == min_bytes;
+    //
+    // big_ptr, small_ptr
+    size_t big_cap, small_cap;
+    void* big_ptr   = thread_alloc::get_memory(min_bytes, big_cap);
+    void* small_ptr = thread_alloc::get_memory(100, small_cap);
+    ok &= min_bytes <= big_cap;
+    ok &= thread_alloc::inuse(thread) == big_cap + small_cap;
+    //
+    // use the memory
+    double* big_double = reinterpret_cast<double*>(big_ptr);
+    size_t  n_double   = big_cap / sizeof(double);
+    for(size_t i = 0; i < n_double; ++i)
+        big_double[i] = double(i);
+    ok &= big_double[n_double - 1] == double(n_double - 1);
+    //
+    // ok
+    // the accounting does not depend on huge_page
+    thread_alloc::return_memory(big_ptr);
+    thread_alloc::return_memory(small_ptr);
+    ok &= thread_alloc::inuse(thread) == 0;
+    ok &= thread_alloc::available(thread) == big_cap + small_cap;
+    //
+    // ok
+    // memory that is held can be reused
+    big_ptr = thread_alloc::get_memory(min_bytes, big_cap);
+    ok &= thread_alloc::available(thread) == small_cap;
+    thread_alloc::return_memory(big_ptr);
+    //
+    // return to the default huge page setting
+    thread_alloc::huge_page(0);
+    //
+    // check that the tests have not held onto memory
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+    //
+    return ok;
+}
+
 } // End empty namespace
 
 bool check_alignment(void)
@@ -221,6 +322,12 @@ bool thread_alloc(void)
     // check alignment
     ok &= check_alignment();
 
+    // run NUMA allocation tests
+    ok &= numa_allocate();
+
+    // run huge page allocation tests
+    ok &= huge_allocate();
+
     // return allocator to its default mode
     thread_alloc::hold_memory(false);
     return ok;
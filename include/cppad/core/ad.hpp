@@ -2,7 +2,7 @@
 # define CPPAD_CORE_AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // simple AD operations that must be defined for AD as well as base class
@@ -55,7 +55,8 @@ private :
         ADVector&  x              ,
         size_t     abort_op_index ,
         bool       record_compare ,
-        ADVector&  dynamic
+        ADVector&  dynamic        ,
+        size_t     reserve
     );
 
     // one argument functions
@@ -302,6 +303,9 @@ private:
     static local::ADTape<Base>*         tape_manage(tape_manage_enum job);
     static local::ADTape<Base>*  tape_ptr(void);
     static local::ADTape<Base>*  tape_ptr(tape_id_t tape_id);
+    static size_t&               tape_cache_thread(void);
+    static tape_id_t&            tape_cache_id(void);
+    static size_t&               tape_cache_setup(void);
 };
 // ---------------------------------------------------------------------------
 
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_AD_FUN_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin ADFun}
@@ -25,6 +25,9 @@ Contents
     include/cppad/core/optimize.hpp
     include/cppad/core/fun_check.hpp
     include/cppad/core/check_for_nan.hpp
+    include/cppad/core/atomic_parallel.hpp
+    include/cppad/core/sweep_profile.hpp
+    include/cppad/core/memory_report.hpp
     include/cppad/core/to_csrc.hpp
 }
 
@@ -34,6 +37,7 @@ Contents
 # include <cppad/local/subgraph/info.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/local/val_graph/val_type.hpp>
+# include <cppad/local/sweep/profile.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
@@ -41,6 +45,35 @@ namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 File used to define the ADFun<Base> class.
 */
 
+/// type for the function that evaluates a batch of independent
+/// atomic function calls (see atomic_parallel.hpp)
+// BEGIN_ATOMIC_PARALLEL_FOR
+typedef void (*atomic_parallel_for)(
+    size_t n_task, void (*task)(size_t i_task, void* info), void* info
+);
+// END_ATOMIC_PARALLEL_FOR
+
+/// one entry in the report returned by sweep_profile
+/// (see sweep_profile.hpp)
+// BEGIN_SWEEP_PROFILE_RECORD
+struct sweep_profile_record {
+    std::string sweep;   // forward_0, forward_any, or reverse
+    std::string name;    // operator name or atomic function name
+    bool        atomic;  // is this an atomic function
+    size_t      count;   // number of times it was executed
+    double      seconds; // total time for all the executions
+};
+// END_SWEEP_PROFILE_RECORD
+
+/// one entry in the report returned by memory_report
+/// (see memory_report.hpp)
+// BEGIN_MEMORY_REPORT_RECORD
+struct memory_report_record {
+    std::string name;    // name of this part of the ADFun object
+    size_t      bytes;   // number of bytes allocated for this part
+};
+// END_MEMORY_REPORT_RECORD
+
 /*!
 Class used to hold function objects
 
@@ -71,6 +104,14 @@ private:
     /// Check for nan's and report message to user (default value is true).
     bool check_for_nan_;
 
+    /// If true, the forward_0, forward_any, and reverse sweeps count and time
+    /// each operator (default value is false).
+    bool sweep_profile_on_;
+
+    /// If not null, used to evaluate independent atomic function calls
+    /// during zero order forward mode (default value is null).
+    atomic_parallel_for atomic_parallel_;
+
     /// If zero, ignoring comparison operators. Otherwise is the
     /// compare change count at which to store the operator index.
     size_t compare_change_count_;
@@ -125,6 +166,9 @@ private:
     /// the operation sequence corresponding to this object
     local::player<Base> play_;
 
+    /// counts and times for the sweeps (used when sweep_profile_on_ is true)
+    local::sweep::profile sweep_profile_;
+
     /// subgraph information for this object
     local::subgraph::subgraph_info subgraph_info_;
 
@@ -146,6 +190,10 @@ private:
     template <class ADvector>
     void Dependent(local::ADTape<Base> *tape, const ADvector &y);
 
+    // set private data corresponding to a new recording
+    // (doxygen in cppad/core/fun_splice.hpp)
+    void set_recording(local::recorder<Base>& rec, size_t n_ind);
+
     // vector of bool version of ForSparseJac
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -323,6 +371,19 @@ public:
     );
     void val_optimize(const std::string& options);
 
+    // splice functions together into one ADFun object
+    // (doxygen in cppad/core/fun_splice.hpp)
+    template <class SizeVector>
+    void splice(
+        const std::vector<ADFun>& fun_vec   ,
+        const SizeVector&         var_index ,
+        const SizeVector&         dyn_index
+    );
+
+    // compose two ADFun objects into one
+    // (doxygen in cppad/core/fun_compose.hpp)
+    void compose(const ADFun& g, const ADFun& f);
+
     // create ADFun< AD<Base> > from this ADFun<Base>
     // (doxygen in cppad/core/base2ad.hpp)
     ADFun< AD<Base>, RecBase > base2ad(void) const;
@@ -340,6 +401,21 @@ public:
     /// get check_for_nan
     bool check_for_nan(void) const;
 
+    /// set atomic_parallel
+    void atomic_parallel(atomic_parallel_for par_for);
+
+    /// get atomic_parallel
+    atomic_parallel_for atomic_parallel(void) const;
+
+    /// turn sweep profiling on or off
+    void sweep_profile(bool on);
+
+    /// get the sweep profile report
+    vector<sweep_profile_record> sweep_profile(void) const;
+
+    /// get the memory report
+    vector<memory_report_record> memory_report(void) const;
+
     /// assign a new operation sequence
     template <class ADvector>
     void Dependent(const ADvector &x, const ADvector &y);
@@ -348,6 +424,10 @@ public:
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
 
+    /// new_dynamic user API, only some independent dynamic parameters change
+    template <class BaseVector, class SizeVector>
+    void new_dynamic(const BaseVector& dynamic, const SizeVector& change);
+
     /// forward mode user API, one order multiple directions.
     template <class BaseVector>
     BaseVector Forward(size_t q, size_t r, const BaseVector& x);
@@ -358,10 +438,27 @@ public:
         size_t q, const BaseVector& xq, std::ostream& s = std::cout
     );
 
+    /// zero order forward mode that only recomputes what has changed
+    template <class BaseVector, class SizeVector>
+    BaseVector forward_change(
+        const BaseVector&    x      ,
+        const SizeVector&    change ,
+        forward_change_work& work
+    );
+
+    // forward_change: determine subset of operators
+    // (doxygen in cppad/core/forward/forward_change.hpp)
+    template <class Addr>
+    void forward_change_subset(forward_change_work& work);
+
     /// reverse mode sweep
     template <class BaseVector>
     BaseVector Reverse(size_t p, const BaseVector &v);
 
+    /// reverse mode sweep for multiple weight vectors
+    template <class BaseVector>
+    BaseVector Reverse(size_t q, size_t r, const BaseVector &w);
+
     // forward Jacobian sparsity pattern
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -714,6 +811,16 @@ public:
     template <class BaseVector>
     BaseVector Hessian(const BaseVector &x, size_t i);
 
+    /// calculate Hessian times a batch of vectors
+    template <class BaseVector>
+    void hes_vec_batch(
+        const BaseVector&   x     ,
+        const BaseVector&   w     ,
+        const BaseVector&   v     ,
+        BaseVector&         hv    ,
+        hes_vec_work<Base>& work
+    );
+
     /// forward mode calculation of partial w.r.t one domain component
     template <class BaseVector>
     BaseVector ForOne(
@@ -861,6 +968,7 @@ public:
 # include <cppad/local/sweep/rev_jac.hpp>
 # include <cppad/local/sweep/rev_hes.hpp>
 # include <cppad/local/sweep/for_hes.hpp>
+# include <cppad/local/sweep/edge_push.hpp>
 # include <cppad/core/graph/from_graph.hpp>
 # include <cppad/core/graph/to_graph.hpp>
 
@@ -870,11 +978,16 @@ public:
 # include <cppad/core/dependent.hpp>
 # include <cppad/core/fun_construct.hpp>
 # include <cppad/core/base2ad.hpp>
+# include <cppad/core/fun_splice.hpp>
+# include <cppad/core/fun_compose.hpp>
 # include <cppad/core/abort_recording.hpp>
 # include <cppad/core/fun_eval.hpp>
 # include <cppad/core/drivers.hpp>
 # include <cppad/core/fun_check.hpp>
 # include <cppad/core/omp_max_thread.hpp>
+# include <cppad/core/atomic_parallel.hpp>
+# include <cppad/core/sweep_profile.hpp>
+# include <cppad/core/memory_report.hpp>
 # include <cppad/core/optimize.hpp>
 # include <cppad/core/abs_normal_fun.hpp>
 # include <cppad/core/graph/from_json.hpp>
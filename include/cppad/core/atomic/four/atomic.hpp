@@ -2,7 +2,7 @@
 # define CPPAD_CORE_ATOMIC_FOUR_ATOMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four_define}
@@ -118,6 +118,7 @@ Contents
     include/cppad/core/atomic/four/jac_sparsity.hpp
     include/cppad/core/atomic/four/hes_sparsity.hpp
     include/cppad/core/atomic/four/rev_depend.hpp
+    include/cppad/core/atomic/four/thread_work.hpp
 }
 
 {xrst_end atomic_four_define}
@@ -173,6 +174,26 @@ private:
     // Not using: vector<work_struct*> work_;
     // so that deprecated atomic examples do not result in a memory leak.
     work_struct* work_[CPPAD_MAX_NUM_THREADS];
+    //
+    /// work space for the derived class, one for each thread;
+    /// see thread_work in thread_work.hpp
+    void* thread_work_[CPPAD_MAX_NUM_THREADS];
+    //
+    /// function that frees the corresponding thread_work_ pointer
+    void (*free_thread_work_[CPPAD_MAX_NUM_THREADS])(void* v_ptr);
+    //
+    /// frees thread_work_ for a specified thread
+    void free_thread_work(size_t thread)
+    {   if( thread_work_[thread] != nullptr )
+        {   free_thread_work_[thread]( thread_work_[thread] );
+            thread_work_[thread]      = nullptr;
+            free_thread_work_[thread] = nullptr;
+        }
+    }
+    // -----------------------------------------------------
+protected:
+    // thread_work
+    template <class Work> Work& thread_work(void);
     // -----------------------------------------------------
 public:
     //
@@ -359,7 +380,9 @@ public:
         //
         // free temporary work memory
         for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; thread++)
-            free_work(thread);
+        {   free_work(thread);
+            free_thread_work(thread);
+        }
     }
     /// allocates work_ for a specified thread
     void allocate_work(size_t thread)
@@ -431,5 +454,6 @@ public:
 # include <cppad/core/atomic/four/reverse.hpp>
 # include <cppad/core/atomic/four/jac_sparsity.hpp>
 # include <cppad/core/atomic/four/hes_sparsity.hpp>
+# include <cppad/core/atomic/four/thread_work.hpp>
 
 # endif
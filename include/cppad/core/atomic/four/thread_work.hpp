@@ -0,0 +1,124 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_THREAD_WORK_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_THREAD_WORK_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin atomic_four_thread_work}
+
+Atomic Function Work Space for Each Thread
+##########################################
+
+Syntax
+******
+| *Work* & *work* = ``this->template thread_work`` < *Work* >()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+This gives an :ref:`atomic_four_ctor@atomic_user` callback
+a work space that is only used by the current thread.
+This makes it possible for a single *afun* object to be used by
+multiple threads at the same time; see :ref:`atomic_four_thread_work@Parallel Mode`
+below.
+
+Work
+****
+This is the type of the work space.
+It must have a default constructor.
+The same *Work* type must be used for every call to ``thread_work``
+by one *afun* object.
+
+work
+****
+The return value is a reference to the work space
+for this *afun* object and the current thread; see
+:ref:`ta_thread_num-name` .
+The first time ``thread_work`` is called by a thread,
+the work space is created using the *Work* default constructor.
+After that, the same work space is returned for that thread
+(and retains its values between callbacks).
+The memory for the work space is obtained using
+:ref:`ta_get_memory-name` and is freed when *afun* is deleted.
+
+Parallel Mode
+*************
+During :ref:`parallel<ta_in_parallel-name>` execution,
+each thread must use its own :ref:`ADFun-name` objects,
+but different threads can use the same *afun* object.
+In this case the callbacks for *afun* (e.g., ``forward`` and ``reverse`` )
+may be called by different threads at the same time
+and should satisfy the following conditions:
+
+#.  They should not modify any member data of the *atomic_user* class
+    other than the work space returned by ``thread_work`` .
+#.  Any information that the callbacks need for a *call_id*
+    should be set before entering parallel mode,
+    or during parallel mode by the thread that uses the corresponding *call_id* .
+
+The mapping from an atomic function index to the corresponding *afun*
+object (that is used by the forward and reverse sweeps)
+is only changed by the ``atomic_four`` constructor and destructor.
+These cannot be called in parallel mode and hence
+looking up *afun* during a sweep does not require a lock.
+
+Example
+*******
+{xrst_toc_hidden
+    example/atomic_four/thread_work.cpp
+}
+The file :ref:`atomic_four_thread_work.cpp-name`
+contains an example and test that uses this function.
+
+{xrst_end atomic_four_thread_work}
+-------------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE
+template <class Base>
+template <class Work>
+Work& atomic_four<Base>::thread_work(void)
+// END_PROTOTYPE
+{   //
+    // free_fun
+    // function that is used to free the work space for this Work type
+    struct free_work_struct {
+        static void free_work(void* v_ptr)
+        {   reinterpret_cast<Work*>(v_ptr)->~Work();
+            thread_alloc::return_memory(v_ptr);
+        }
+    };
+    void (*free_fun)(void*) = free_work_struct::free_work;
+    //
+    // thread
+    size_t thread = thread_alloc::thread_num();
+    //
+    // thread_work_[thread], free_thread_work_[thread]
+    if( thread_work_[thread] == nullptr )
+    {   // allocate the raw memory
+        size_t min_bytes = sizeof(Work);
+        size_t num_bytes;
+        void*  v_ptr     = thread_alloc::get_memory(min_bytes, num_bytes);
+        //
+        // call constructor
+        new( v_ptr ) Work;
+        //
+        thread_work_[thread]      = v_ptr;
+        free_thread_work_[thread] = free_fun;
+    }
+    CPPAD_ASSERT_KNOWN( free_thread_work_[thread] == free_fun,
+        "atomic_four: thread_work: Work type is different from a previous call"
+    );
+    return *reinterpret_cast<Work*>( thread_work_[thread] );
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
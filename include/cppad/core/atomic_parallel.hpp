@@ -0,0 +1,134 @@
+# ifndef CPPAD_CORE_ATOMIC_PARALLEL_HPP
+# define CPPAD_CORE_ATOMIC_PARALLEL_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin atomic_parallel}
+{xrst_spell
+    omp
+    pragma
+}
+
+Evaluate Independent Atomic Function Calls in Parallel
+######################################################
+
+Syntax
+******
+| *f* . ``atomic_parallel`` ( *par_for* )
+| *par_for* = *f* . ``atomic_parallel`` ()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+The :ref:`zero order forward<forward_zero-name>` sweep for *f*
+normally evaluates each atomic function call (for example a
+:ref:`chkpoint_two-name` function) when it is reached.
+If *par_for* is not null, the zero order forward sweep instead
+collects atomic function calls that do not depend on each other.
+This batch of calls is evaluated, using *par_for* ,
+just before one of its results is used.
+This can make it possible to evaluate expensive atomic functions
+concurrently without breaking the recording into multiple ``ADFun`` objects.
+
+f
+*
+This is the ``ADFun`` object that the setting applies to.
+The default value for *par_for* is null; i.e., the atomic functions
+are evaluated in order and by the current thread.
+This value is copied by the ``ADFun``
+:ref:`assignment<fun_construct@Assignment Operator>` operator,
+but it is not copied by :ref:`base2ad-name` .
+
+par_for
+*******
+The type ``atomic_parallel_for`` is defined by
+{xrst_literal
+    include/cppad/core/ad_fun.hpp
+    // BEGIN_ATOMIC_PARALLEL_FOR
+    // END_ATOMIC_PARALLEL_FOR
+}
+The syntax
+
+    *par_for* ( *n_task* , *task* , *info* )
+
+must execute
+
+    *task* ( *i_task* , *info* )
+
+for *i_task* equal 0, ... , *n_task* ``-1`` .
+These calls can be made in any order and by different threads.
+They must all be completed before *par_for* returns.
+For example, using OpenMP, *par_for* could be defined by::
+
+    void par_for(size_t n_task, void (*task)(size_t, void*), void* info)
+    {   # pragma omp parallel for
+        for(int i_task = 0; i_task < int(n_task); ++i_task)
+            task( size_t(i_task), info );
+    }
+
+Requirements
+************
+If *par_for* uses multiple threads:
+
+#.  The CppAD :ref:`multi_thread-name` requirements must be satisfied;
+    e.g., :ref:`parallel_setup<ta_parallel_setup-name>` must have been
+    called and the threads must have the corresponding
+    :ref:`thread numbers<ta_thread_num-name>` .
+#.  The atomic functions used by *f* must support being called by
+    multiple threads at the same time; e.g., :ref:`chkpoint_two-name`
+    functions with *use_in_parallel* true, or ``atomic_four``
+    functions that use :ref:`atomic_four_thread_work-name` .
+#.  Zero order forward mode for *f* must be called in sequential mode.
+
+Only zero order forward mode is affected by this setting.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/atomic_parallel.cpp
+}
+The file :ref:`atomic_parallel.cpp-name`
+contains an example and test of this setting.
+
+{xrst_end atomic_parallel}
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file atomic_parallel.hpp
+Set and get the function used to evaluate independent atomic calls.
+*/
+
+/*!
+Set the function used to evaluate independent atomic function calls.
+
+\param par_for
+is the new value for this setting (null means do not batch atomic calls).
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::atomic_parallel(atomic_parallel_for par_for)
+// END_PROTOTYPE
+{   atomic_parallel_ = par_for; }
+
+/*!
+Get the function used to evaluate independent atomic function calls.
+
+\return
+current value of atomic_parallel_.
+*/
+template <class Base, class RecBase>
+atomic_parallel_for ADFun<Base,RecBase>::atomic_parallel(void) const
+{   return atomic_parallel_; }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -0,0 +1,287 @@
+# ifndef CPPAD_CORE_BRANCH_CACHE_HPP
+# define CPPAD_CORE_BRANCH_CACHE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin branch_cache}
+{xrst_spell
+    ax
+    ay
+}
+
+Cache of Recordings for Different Comparison Results
+####################################################
+
+Syntax
+******
+| ``class`` *cache_class* : ``public CppAD::branch_cache`` < *Base* > {
+| ``public:``
+| |tab| *cache_class* ( *max_size* ) : ``CppAD::branch_cache`` < *Base* > ( *max_size* )
+| |tab| { ... }
+| |tab| ``void algo`` ( ``const`` *ADVector* & *ax* , *ADVector* & *ay* ) ``override``
+| |tab| { ... }
+| };
+| *cache_class* *cache* ( *max_size* )
+| *y* = *cache* . ``forward`` ( *x* )
+| *f* = *cache* . ``fun`` ()
+| *s* = *cache* . ``size`` ()
+| *h* = *cache* . ``n_hit`` ()
+| *h* = *cache* . ``n_miss`` ()
+| *cache* . ``clear`` ()
+
+Purpose
+*******
+If an algorithm contains an ``if`` statement that depends on the value
+of an ``AD`` < *Base* > variable,
+the corresponding recording is only valid while the
+:ref:`comparison operators<compare_change-name>` have the same result
+as during the recording.
+This class keeps a cache of recordings for the algorithm.
+It uses the recording for which all the comparison operators
+have the same result as during its recording,
+and only records the algorithm when there is no such recording.
+This avoids retaping when the argument returns to a region
+that has been recorded before; e.g., a piecewise defined function.
+
+Base
+****
+This is the base type for the recordings; i.e.,
+the recordings are ``ADFun`` < *Base* > objects.
+
+ADVector
+********
+This is the type ``CppAD::vector< AD`` < *Base* > > .
+
+algo
+****
+This virtual function is defined by the *cache_class* .
+It computes the function that is recorded.
+
+ax
+==
+This is the argument to the function and its size is *n* .
+
+ay
+==
+The input size of this vector is zero.
+Upon return it is the result of the function and its size is *m* .
+The range size *m* must be the same for all calls to *algo* .
+
+max_size
+********
+This is the maximum number of recordings in the cache.
+When a new recording is required and there are *max_size* recordings
+in the cache, the least recently used recording is removed.
+It must be greater than zero.
+
+forward
+*******
+
+x
+=
+This *BaseVector* is the value of the argument to the function
+and has size *n* .
+The *BaseVector* type must be a
+:ref:`SimpleVector-name` class with elements of type *Base* .
+The size *n* must be the same for all calls to ``forward``
+(until ``clear`` is called).
+
+y
+=
+The return value *y* has size *m* and is the value of the function.
+It is computed using zero order forward mode on a recording for which
+:ref:`compare_change@number` is zero.
+
+Cost
+====
+The recordings in the cache are checked in most recently used order.
+Each recording that is checked requires one zero order forward sweep.
+If none of the recordings in the cache can be used,
+*algo* is recorded at *x* and the new recording is put in the cache.
+
+fun
+***
+The return value *f* has prototype
+
+    ``ADFun`` < *Base* >& *f*
+
+It is the recording used by the previous call to ``forward`` .
+Its zero order Taylor coefficients correspond to the previous *x* .
+Hence it can be used to compute derivatives at *x* ; e.g.,
+*f* . ``Jacobian`` ( *x* ) .
+It can only be used until the next call to ``forward`` or ``clear`` .
+
+size
+****
+The return value *s* has type ``size_t`` and is the number
+of recordings in the cache.
+
+n_hit
+*****
+The return value *h* has type ``size_t`` and is the number
+of calls to ``forward`` that used a recording in the cache.
+
+n_miss
+******
+The return value *h* has type ``size_t`` and is the number
+of calls to ``forward`` that required a new recording.
+
+clear
+*****
+This removes all the recordings from the cache and sets
+*n_hit* and *n_miss* to zero.
+
+Restriction
+***********
+Only comparisons that are recorded are checked;
+e.g., control flow that depends on :ref:`Integer-name` or
+:ref:`Value-name` is not detected.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/branch_cache.cpp
+}
+The file :ref:`branch_cache.cpp-name`
+contains an example and test of this class.
+
+{xrst_end branch_cache}
+-------------------------------------------------------------------------------
+*/
+# include <list>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file branch_cache.hpp
+Cache of recordings for different comparison results.
+*/
+/*!
+Cache of recordings of an algorithm, one for each set of comparison results.
+
+\tparam Base
+base type for the recordings.
+*/
+template <class Base>
+class branch_cache {
+public:
+    /// type of the argument and result vectors for the algorithm
+    typedef CppAD::vector< AD<Base> > ADVector;
+private:
+    /// maximum number of recordings in the cache
+    const size_t max_size_;
+    /// recordings with most recently used at the front
+    std::list< ADFun<Base> > fun_list_;
+    /// number of calls to forward that used a recording in the cache
+    size_t n_hit_;
+    /// number of calls to forward that required a new recording
+    size_t n_miss_;
+public:
+    /// constructor
+    branch_cache(size_t max_size) :
+    max_size_(max_size), n_hit_(0), n_miss_(0)
+    {   CPPAD_ASSERT_KNOWN( max_size > 0,
+            "branch_cache: max_size is zero"
+        );
+    }
+    /// destructor
+    virtual ~branch_cache(void)
+    { }
+    /*!
+    Algorithm that is recorded (defined by the derived class).
+
+    \param ax [in]
+    argument to the algorithm.
+
+    \param ay [out]
+    input size is zero, upon return is the result of the algorithm.
+    */
+    virtual void algo(const ADVector& ax, ADVector& ay) = 0;
+    //
+    /// number of recordings in the cache
+    size_t size(void) const
+    {   return fun_list_.size(); }
+    //
+    /// number of calls to forward that used a recording in the cache
+    size_t n_hit(void) const
+    {   return n_hit_; }
+    //
+    /// number of calls to forward that required a new recording
+    size_t n_miss(void) const
+    {   return n_miss_; }
+    //
+    /// remove all the recordings and zero the statistics
+    void clear(void)
+    {   fun_list_.clear();
+        n_hit_  = 0;
+        n_miss_ = 0;
+    }
+    //
+    /// recording used by the previous call to forward
+    ADFun<Base>& fun(void)
+    {   CPPAD_ASSERT_KNOWN( fun_list_.size() > 0,
+            "branch_cache: fun() called before forward(x)"
+        );
+        return fun_list_.front();
+    }
+    /*!
+    Evaluate the algorithm using a recording in the cache,
+    or make a new recording.
+
+    \param x
+    value of the argument to the algorithm.
+
+    \return
+    value of the result of the algorithm.
+    */
+    template <class BaseVector>
+    BaseVector forward(const BaseVector& x)
+    {   typedef typename std::list< ADFun<Base> >::iterator iterator;
+        //
+        // n
+        size_t n = size_t( x.size() );
+        CPPAD_ASSERT_KNOWN( fun_list_.size() == 0 ||
+            fun_list_.front().Domain() == n,
+            "branch_cache: size of x changed without a call to clear()"
+        );
+        //
+        // y
+        // check the recordings in most recently used order
+        BaseVector y;
+        for(iterator itr = fun_list_.begin(); itr != fun_list_.end(); ++itr)
+        {   y = itr->Forward(0, x);
+            if( itr->compare_change_number() == 0 )
+            {   // move this recording to the front
+                fun_list_.splice(fun_list_.begin(), fun_list_, itr);
+                ++n_hit_;
+                return y;
+            }
+        }
+        //
+        // ax, ay
+        // record the algorithm at x
+        ADVector ax(n), ay;
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        Independent(ax);
+        algo(ax, ay);
+        //
+        // fun_list_
+        // the constructor computes the zero order Taylor coefficients at x
+        fun_list_.emplace_front(ax, ay);
+        if( fun_list_.size() > max_size_ )
+            fun_list_.pop_back();
+        ++n_miss_;
+        //
+        // y
+        size_t m = ay.size();
+        y.resize(m);
+        for(size_t i = 0; i < m; ++i)
+            y[i] = Value( ay[i] );
+        return y;
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_CHKPOINT_TWO_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -60,6 +60,8 @@ because the same checkpoint function may be used repeatedly
 with different arguments during a single forward mode operation.
 Thus, forward mode results are computed for each use of *chk_fun*
 in a forward mode sweep.
+The :ref:`chkpoint_two_memo-name` function can be used to
+remember results when the same arguments are used repeatedly.
 
 Operation Sequence
 ******************
@@ -93,6 +95,7 @@ Contents
     include/cppad/core/chkpoint_two/ctor.hpp
     include/cppad/core/chkpoint_two/chk_fun.xrst
     include/cppad/core/chkpoint_two/dynamic.hpp
+    include/cppad/core/chkpoint_two/memo.hpp
     example/chkpoint_two/get_started.cpp
     example/chkpoint_two/compare.cpp
     example/chkpoint_two/base2ad.cpp
@@ -134,6 +137,65 @@ private:
     /// AD version of function corresponding to this checkpoint object
     /// If use_in_parallel_, this is constant after the constructor.
     ADFun< AD<Base>, Base>  ag_;
+    //
+    // ------------------------------------------------------------------------
+    // memo
+    // ------------------------------------------------------------------------
+    /// maximum number of entries in the memo for each thread
+    /// (zero means results are not memorized).
+    size_t memo_size_;
+    //
+    /// one forward or reverse result for g(x)
+    struct memo_entry {
+        /// is this a reverse mode result
+        bool         reverse;
+        /// highest order for this calculation
+        size_t       order_up;
+        /// Taylor coefficients for x
+        vector<Base> taylor_x;
+        /// partials w.r.t. the y Taylor coefficients (reverse mode only)
+        vector<Base> partial_y;
+        /// taylor_y for forward mode, partial_x for reverse mode
+        vector<Base> result;
+    };
+    //
+    /// memorized results for one thread
+    struct memo_struct {
+        /// number of calculations that used a memorized result
+        size_t             n_hit;
+        /// number of calculations that did not find a memorized result
+        size_t             n_miss;
+        /// index in entry of the next entry to replace
+        size_t             next;
+        /// the memorized results
+        vector<memo_entry> entry;
+        //
+        memo_struct(void) : n_hit(0), n_miss(0), next(0)
+        { }
+    };
+    //
+    /// memo for the case where use_in_parallel_ is false
+    memo_struct memo_;
+    //
+    /// search memo for a result, return true if found
+    bool memo_find(
+        memo_struct&         memo      ,
+        bool                 reverse   ,
+        size_t               order_up  ,
+        const vector<Base>&  taylor_x  ,
+        const vector<Base>&  partial_y ,
+        vector<Base>&        result
+    );
+    //
+    /// store a result in memo
+    void memo_store(
+        memo_struct&         memo      ,
+        bool                 reverse   ,
+        size_t               order_up  ,
+        const vector<Base>&  taylor_x  ,
+        const vector<Base>&  partial_y ,
+        const vector<Base>&  result
+    );
     // ------------------------------------------------------------------------
     // member_
     // ------------------------------------------------------------------------
@@ -147,6 +209,9 @@ private:
         /// AD version of this function object
         ADFun< AD<Base>, Base >     ag_;
         //
+        /// memorized results for this thread
+        memo_struct                 memo_;
+        //
     };
     /// use pointers and allocate memory to avoid false sharing
     /// (initialized to null by constructor)
@@ -288,7 +353,8 @@ public:
     use_base2ad_      ( other.use_base2ad_ ) ,
     use_in_parallel_  ( other.use_in_parallel_ ) ,
     jac_sparsity_     ( other.jac_sparsity_ ) ,
-    hes_sparsity_     ( other.hes_sparsity_ )
+    hes_sparsity_     ( other.hes_sparsity_ ) ,
+    memo_size_        ( other.memo_size_ )
     {   g_  = other.g_;
         ag_ = other.ag_;
     }
@@ -296,12 +362,19 @@ public:
     // new_dynamic
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
+    //
+    // memo_size
+    void memo_size(size_t max_entry);
+    //
+    // memo_count
+    void memo_count(size_t& n_hit, size_t& n_miss);
 };
 
 } // END_CPPAD_NAMESPACE
 
 # include <cppad/core/chkpoint_two/ctor.hpp>
 # include <cppad/core/chkpoint_two/dynamic.hpp>
+# include <cppad/core/chkpoint_two/memo.hpp>
 # include <cppad/core/chkpoint_two/for_type.hpp>
 # include <cppad/core/chkpoint_two/forward.hpp>
 # include <cppad/core/chkpoint_two/reverse.hpp>
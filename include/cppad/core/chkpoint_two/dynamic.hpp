@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_DYNAMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin chkpoint_two_dynamic}
@@ -59,6 +59,11 @@ there is a separate copy of *fun* for each thread.
 In this case, only the dynamic parameters in the copy for the current
 :ref:`thread number<ta_thread_num-name>` are changed.
 
+Memo
+****
+The :ref:`memorized<chkpoint_two_memo-name>` results
+for the current thread are discarded.
+
 {xrst_end chkpoint_two_dynamic}
 */
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -83,11 +88,13 @@ template <class Base>
 template <class BaseVector>
 void chkpoint_two<Base>::new_dynamic(const BaseVector& dynamic)
 // END_PROTOTYPE
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>* g_ptr    = &g_;
+    memo_struct* memo_ptr = &memo_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr    = &(member_[thread]->g_);
+        memo_ptr = &(member_[thread]->memo_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -97,6 +104,10 @@ void chkpoint_two<Base>::new_dynamic(const BaseVector& dynamic)
     }
 # endif
     g_ptr->new_dynamic(dynamic);
+    //
+    // memorized results depend on the previous dynamic parameters
+    memo_ptr->entry.clear();
+    memo_ptr->next = 0;
 }
 
 } // END_CPPAD_NAMESPACE
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_FORWARD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
@@ -44,11 +44,13 @@ bool chkpoint_two<Base>::forward(
     size_t                       order_up    ,
     const vector<Base>&          taylor_x    ,
     vector<Base>&                taylor_y    )
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>* g_ptr    = &g_;
+    memo_struct* memo_ptr = &memo_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr    = &(member_[thread]->g_);
+        memo_ptr = &(member_[thread]->memo_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -57,9 +59,23 @@ bool chkpoint_two<Base>::forward(
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # endif
+    // check for a memorized result
+    bool reverse = false;
+    vector<Base> not_used;
+    if( memo_size_ > 0 )
+    {   if( memo_find(
+            *memo_ptr, reverse, order_up, taylor_x, not_used, taylor_y
+        ) ) return true;
+    }
+    //
     // compute forward mode results for all values and orders
     taylor_y = g_ptr->Forward(order_up, taylor_x);
     //
+    // memorize this result
+    if( memo_size_ > 0 ) memo_store(
+        *memo_ptr, reverse, order_up, taylor_x, not_used, taylor_y
+    );
+    //
     return true;
 }
 /*!
@@ -0,0 +1,261 @@
+# ifndef CPPAD_CORE_CHKPOINT_TWO_MEMO_HPP
+# define CPPAD_CORE_CHKPOINT_TWO_MEMO_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin chkpoint_two_memo}
+{xrst_spell
+    chk
+}
+
+Memorize Checkpoint Function Results
+####################################
+
+Syntax
+******
+| *chk_fun* . ``memo_size`` ( *max_entry* )
+| *chk_fun* . ``memo_count`` ( *n_hit* , *n_miss* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_MEMO_SIZE
+    // END_MEMO_SIZE
+}
+{xrst_literal
+    // BEGIN_MEMO_COUNT
+    // END_MEMO_COUNT
+}
+
+Purpose
+*******
+Each time a forward or reverse sweep for an ``ADFun`` < *Base* >
+object reaches a use of *chk_fun* ,
+the corresponding sweep for :math:`g(x)` is computed; see
+:ref:`chkpoint_two@Repeating Forward` .
+If the same arguments are used many times,
+(for example, a time stepping model that repeats the same state,
+or multiple reverse mode sweeps at the same argument value),
+it may be faster to remember the previous results.
+This is called memorizing the results.
+
+chk_fun
+*******
+This object must have been created using the
+:ref:`chkpoint_two<chkpoint_two_ctor@chk_fun>` constructor.
+
+max_entry
+*********
+This is the maximum number of results that are memorized
+(for each thread).
+If it is zero, results are not memorized.
+This is the default value (set by the *chk_fun* constructor).
+When a new result is memorized and there are already *max_entry*
+results, the oldest result is replaced.
+
+Key
+===
+A forward mode result is identified by the order and the value of
+all the Taylor coefficients for :math:`x`.
+A reverse mode result is also identified by the value of
+the partial derivatives with respect to the Taylor coefficients for
+:math:`y` .
+Thus the time to check for a result is proportional to
+*max_entry* times the number of Taylor coefficients;
+i.e., *max_entry* should be small.
+
+Base Only
+=========
+Only results for ``ADFun`` < *Base* > objects are memorized; i.e.,
+results for the :ref:`chkpoint_two_ctor@use_base2ad` case
+are always computed.
+
+Dynamic Parameters
+==================
+The memorized results for the current thread are discarded when
+:ref:`chkpoint_two_dynamic-name` is used to change the dynamic
+parameters in *fun* .
+
+n_hit
+*****
+The input value of this argument does not matter.
+Upon return, it is the number of forward and reverse mode
+calculations that used a memorized result.
+
+n_miss
+******
+The input value of this argument does not matter.
+Upon return, it is the number of forward and reverse mode
+calculations (with *max_entry* non-zero) that did not find a
+memorized result.
+
+Multi-Threading
+***************
+If *use_in_parallel* is true,
+each thread has a separate set of memorized results.
+In this case, *n_hit* and *n_miss* are the counts
+for the current :ref:`thread number<ta_thread_num-name>` .
+The ``memo_size`` function cannot be called in
+:ref:`parallel<ta_in_parallel-name>` mode.
+It discards the memorized results, and zeros the counts,
+for all the threads.
+
+Example
+*******
+{xrst_toc_hidden
+    example/chkpoint_two/memo.cpp
+}
+The file :ref:`chkpoint_two_memo.cpp-name`
+contains an example and test of these functions.
+
+{xrst_end chkpoint_two_memo}
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file chkpoint_two/memo.hpp
+Memorize forward and reverse results for a checkpoint function.
+*/
+
+// BEGIN_MEMO_SIZE
+template <class Base>
+void chkpoint_two<Base>::memo_size(size_t max_entry)
+// END_MEMO_SIZE
+{   CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "chkpoint_two: memo_size cannot be called in parallel mode."
+    );
+    memo_size_ = max_entry;
+    memo_      = memo_struct();
+    for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; ++thread)
+    {   if( member_[thread] != nullptr )
+            member_[thread]->memo_ = memo_struct();
+    }
+}
+
+// BEGIN_MEMO_COUNT
+template <class Base>
+void chkpoint_two<Base>::memo_count(size_t& n_hit, size_t& n_miss)
+// END_MEMO_COUNT
+{   memo_struct* memo_ptr = &memo_;
+    if( use_in_parallel_ )
+    {   size_t thread = thread_alloc::thread_num();
+        allocate_member(thread);
+        memo_ptr = &(member_[thread]->memo_);
+    }
+    n_hit  = memo_ptr->n_hit;
+    n_miss = memo_ptr->n_miss;
+}
+
+/*!
+Search the memo for a result
+
+\param memo [in,out]
+is the memo for the current thread.
+The hit or miss count is incremented.
+
+\param reverse [in]
+is this a reverse mode (or forward mode) calculation.
+
+\param order_up [in]
+is the highest order for this calculation.
+
+\param taylor_x [in]
+Taylor coefficients corresponding to x for this calculation.
+
+\param partial_y [in]
+Partials w.r.t. the y Taylor coefficients (not used for forward mode).
+
+\param result [out]
+If the return value is true, this is taylor_y (forward mode) or
+partial_x (reverse mode). Otherwise, it is not changed.
+
+\return
+is true if a result was found.
+*/
+template <class Base>
+bool chkpoint_two<Base>::memo_find(
+    memo_struct&         memo      ,
+    bool                 reverse   ,
+    size_t               order_up  ,
+    const vector<Base>&  taylor_x  ,
+    const vector<Base>&  partial_y ,
+    vector<Base>&        result    )
+{   CPPAD_ASSERT_UNKNOWN( memo_size_ > 0 );
+    for(size_t k = 0; k < memo.entry.size(); ++k)
+    {   const memo_entry& entry = memo.entry[k];
+        bool match = entry.reverse == reverse;
+        match     &= entry.order_up == order_up;
+        match     &= entry.taylor_x.size() == taylor_x.size();
+        for(size_t j = 0; match && j < taylor_x.size(); ++j)
+            match = entry.taylor_x[j] == taylor_x[j];
+        if( match && reverse )
+        {   match = entry.partial_y.size() == partial_y.size();
+            for(size_t i = 0; match && i < partial_y.size(); ++i)
+                match = entry.partial_y[i] == partial_y[i];
+        }
+        if( match )
+        {   result = entry.result;
+            ++memo.n_hit;
+            return true;
+        }
+    }
+    ++memo.n_miss;
+    return false;
+}
+
+/*!
+Store a result in the memo
+
+\param memo [in,out]
+is the memo for the current thread.
+If it already has memo_size_ entries, the oldest entry is replaced.
+
+\param reverse [in]
+is this a reverse mode (or forward mode) calculation.
+
+\param order_up [in]
+is the highest order for this calculation.
+
+\param taylor_x [in]
+Taylor coefficients corresponding to x for this calculation.
+
+\param partial_y [in]
+Partials w.r.t. the y Taylor coefficients (not used for forward mode).
+
+\param result [in]
+is taylor_y (forward mode) or partial_x (reverse mode).
+*/
+template <class Base>
+void chkpoint_two<Base>::memo_store(
+    memo_struct&         memo      ,
+    bool                 reverse   ,
+    size_t               order_up  ,
+    const vector<Base>&  taylor_x  ,
+    const vector<Base>&  partial_y ,
+    const vector<Base>&  result    )
+{   CPPAD_ASSERT_UNKNOWN( memo_size_ > 0 );
+    //
+    // k
+    size_t k = memo.next;
+    if( memo.entry.size() < memo_size_ )
+    {   k = memo.entry.size();
+        memo.entry.resize(k + 1);
+    }
+    memo.next = (k + 1) % memo_size_;
+    //
+    // memo.entry[k]
+    memo_entry& entry = memo.entry[k];
+    entry.reverse     = reverse;
+    entry.order_up    = order_up;
+    entry.taylor_x    = taylor_x;
+    if( reverse )
+        entry.partial_y = partial_y;
+    else
+        entry.partial_y.resize(0);
+    entry.result      = result;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
@@ -45,11 +45,13 @@ bool chkpoint_two<Base>::reverse(
     vector<Base>&               partial_x     ,
     const vector<Base>&         partial_y     )
 
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>* g_ptr    = &g_;
+    memo_struct* memo_ptr = &memo_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr    = &(member_[thread]->g_);
+        memo_ptr = &(member_[thread]->memo_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -58,6 +60,14 @@ bool chkpoint_two<Base>::reverse(
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # endif
+    // check for a memorized result
+    bool reverse = true;
+    if( memo_size_ > 0 )
+    {   if( memo_find(
+            *memo_ptr, reverse, order_up, taylor_x, partial_y, partial_x
+        ) ) return true;
+    }
+    //
     // compute forward mode Taylor coefficient orders 0 through order_up
 # ifdef NDEBUG
     g_ptr->Forward(order_up, taylor_x);
@@ -70,6 +80,11 @@ bool chkpoint_two<Base>::reverse(
     // now can run reverse mode
     partial_x = g_ptr->Reverse(order_up+1, partial_y);
     //
+    // memorize this result
+    if( memo_size_ > 0 ) memo_store(
+        *memo_ptr, reverse, order_up, taylor_x, partial_y, partial_x
+    );
+    //
     return true;
 }
 /*!
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FORWARD_FORWARD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // documented after Forward but included here so easy to see
@@ -191,6 +191,9 @@ BaseVector ADFun<Base,RecBase>::Forward(
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
+    local::sweep::profile* profile = nullptr;
+    if( sweep_profile_on_ )
+        profile = &sweep_profile_;
     if( q == 0 )
     {   bool print = true;
         local::sweep::forward_0(
@@ -205,7 +208,10 @@ BaseVector ADFun<Base,RecBase>::Forward(
             compare_change_op_index_,
             s,
             print,
-            taylor_.data()
+            taylor_.data(),
+            atomic_parallel_,
+            profile,
+            nullptr
         );
     }
     else
@@ -224,7 +230,8 @@ BaseVector ADFun<Base,RecBase>::Forward(
             print,
             p,
             q,
-            taylor_.data()
+            taylor_.data(),
+            profile
         );
     }
 
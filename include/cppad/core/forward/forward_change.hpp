@@ -0,0 +1,427 @@
+# ifndef CPPAD_CORE_FORWARD_FORWARD_CHANGE_HPP
+# define CPPAD_CORE_FORWARD_FORWARD_CHANGE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin forward_change}
+
+Zero Order Forward Mode When Some Independent Variables Change
+##############################################################
+
+Syntax
+******
+| ``forward_change_work`` *work*
+| *y* = *f* . ``forward_change`` ( *x* , *change* , *work* )
+| *work* . ``clear`` ()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+We use :math:`F : \B{R}^n \rightarrow \B{R}^m` to denote the
+:ref:`glossary@AD Function` corresponding to *f* .
+This routine computes the same value as
+
+    *y* = *f* . ``Forward`` (0, *x* )
+
+but it assumes that only the components of *x* with index in *change*
+are different from the previous zero order forward mode calculation.
+It only evaluates the operators that depend on these components
+and reuses the zero order Taylor coefficients for the other operators.
+This is useful when only a few components of *x* change between
+successive function evaluations; e.g., coordinate descent,
+finite differences, and line searches in a subspace.
+
+f
+*
+This is the ``ADFun`` object for the function :math:`F(x)` .
+Note that *f* is not ``const``; see :ref:`forward_change@Uses Forward`
+below.
+
+x
+*
+This is the point at which :math:`F(x)` is evaluated and its size is *n* .
+It must contain the current value for all the independent variables;
+i.e., if :math:`j \in \{ 0 , \ldots , n-1 \}` is not in *change* ,
+*x* [ *j* ] must be equal to its value in the previous
+zero order forward mode calculation for *f* .
+(All the components of *x* are used in the
+:ref:`forward_change@Full Sweep` cases.)
+
+change
+******
+This is the vector of indices for the components of *x* that changed.
+Each of its elements must be less than *n* .
+
+y
+*
+The return value *y* has size *m* and is equal to :math:`F(x)` .
+
+work
+****
+This structure holds the subset of the operators that depend on *change* .
+It is only recomputed when the set of indices in *change* is different
+from the previous call that used *work* .
+Computing the subset requires a pass through the operation sequence,
+so the most benefit is obtained when the same *change* is used
+for many calls.
+If *work* is used with a different ``ADFun`` object, or the operation
+sequence in *f* changes, *work* . ``clear`` () must be called first.
+It frees the memory in *work* .
+
+Random Access
+=============
+This routine uses random access to the operation sequence
+to compute the subset of the operators.
+The memory used for this can be freed by
+:ref:`subgraph_reverse@clear_subgraph` .
+
+Full Sweep
+**********
+All the operators are evaluated (the same as ``Forward`` (0, *x* ) )
+in the following cases:
+
+#.  There are no zero order Taylor coefficients in *f* ; e.g.,
+    before the first zero order forward, or after a call to
+    :ref:`new_dynamic-name` .
+#.  The previous forward mode calculation used more than one
+    :ref:`direction<forward_dir-name>` .
+#.  The operation sequence uses :ref:`VecAD-name` vectors.
+#.  A conditional skip operator (created by :ref:`optimize-name` )
+    depends on the components of *x* in *change* .
+
+Comparison Operators
+********************
+Only the :ref:`comparison operators<compare_change-name>`
+that depend on the components of *x* in *change* are evaluated.
+Hence, :ref:`compare_change-name` only counts the changes
+for these comparisons.
+
+Uses Forward
+************
+After a call to ``forward_change`` ,
+the zero order Taylor coefficients in *f* correspond to
+*f* . ``Forward`` (0, *x* ) and :ref:`size_order-name` is one.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/forward_change.cpp
+}
+The file :ref:`forward_change.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end forward_change}
+*/
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/subgraph/info.hpp>
+
+/*!
+\file forward_change.hpp
+Zero order forward mode that only recomputes what has changed.
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+Class used to hold the subset of operators that depend on a set of
+independent variables.
+*/
+class forward_change_work {
+    public:
+        /// dependency information for the selected independent variables
+        local::subgraph::subgraph_info   info;
+        /// which independent variables are selected (size zero if none)
+        local::pod_vector<bool>          select;
+        /// flags which independent variables are in the current change
+        local::pod_vector<bool>          flag;
+        /// op index, arg index, and var index for operators in the subset
+        local::pod_vector<size_t>        subset;
+        /// all the operators must be evaluated for this selection
+        bool                             full;
+        //
+        /// constructor
+        forward_change_work(void) : full(true)
+        { }
+        /// free the memory in this work space
+        void clear(void)
+        {   info.clear();
+            select.clear();
+            flag.clear();
+            subset.clear();
+            full = true;
+        }
+};
+// ----------------------------------------------------------------------------
+/*!
+Determine the subset of operators that depend on the selected
+independent variables.
+
+\tparam Addr
+is the type used for indices in the random iterator.
+
+\param work
+On input, work.select is the set of selected independent variables.
+Upon return, work.subset contains the operator index, argument index,
+and variable index for each operator that depends on the selected
+independent variables, plus the EndOp at the end of the operation sequence.
+If a conditional skip operator is in the subset, work.full is true.
+Otherwise it is false.
+*/
+template <class Base, class RecBase>
+template <class Addr>
+void ADFun<Base,RecBase>::forward_change_subset(forward_change_work& work)
+{   using local::pod_vector;
+    //
+    size_t n_ind = ind_taddr_.size();
+    size_t n_dep = dep_taddr_.size();
+    size_t n_op  = play_.num_var_op();
+    CPPAD_ASSERT_UNKNOWN( work.select.size() == n_ind );
+    //
+    // random_itr
+    Addr not_used;
+    play_.setup_random(not_used);
+    local::play::const_random_iterator<Addr> random_itr =
+        play_.get_random(not_used);
+    //
+    // work.info
+    local::subgraph::subgraph_info& info( work.info );
+    info.resize(n_ind, n_dep, n_op, num_var_tape_);
+    info.set_map_user_op(&play_);
+    info.init_rev(random_itr, work.select);
+    const pod_vector<addr_t>& in_subgraph( info.in_subgraph() );
+    const pod_vector<addr_t>& map_user_op( info.map_user_op() );
+    addr_t depend_yes = addr_t( n_dep );
+    //
+    // include, work.full
+    // in_subgraph only marks operators that have results,
+    // so check the arguments for the other operators.
+    pod_vector<bool>   include(n_op);
+    pod_vector<size_t> argument_variable;
+    pod_vector<bool>   arg_work;
+    work.full = false;
+    for(size_t i_op = 0; i_op < n_op; ++i_op)
+    {   local::op_code_var op = random_itr.get_op(i_op);
+        include[i_op] = false;
+        switch( op )
+        {   // independent variables are set before the sweep
+            case local::BeginOp:
+            case local::InvOp:
+            break;
+
+            case local::EndOp:
+            include[i_op] = true;
+            break;
+
+            // only the first AFunOp in a call can be in the subgraph
+            case local::AFunOp:
+            case local::FunapOp:
+            case local::FunavOp:
+            case local::FunrpOp:
+            case local::FunrvOp:
+            include[i_op] = in_subgraph[i_op] == depend_yes;
+            break;
+
+            default:
+            if( 0 < NumRes(op) )
+                include[i_op] = in_subgraph[i_op] == depend_yes;
+            else
+            {   local::subgraph::get_argument_variable(
+                    random_itr, i_op, argument_variable, arg_work
+                );
+                for(size_t j = 0; j < argument_variable.size(); ++j)
+                {   size_t j_op = random_itr.var2op( argument_variable[j] );
+                    j_op        = size_t( map_user_op[j_op] );
+                    if( in_subgraph[j_op] == depend_yes )
+                        include[i_op] = true;
+                }
+            }
+            if( include[i_op] && op == local::CSkipOp )
+                work.full = true;
+            break;
+        }
+    }
+    //
+    // work.subset
+    // sequential pass to get the iterator state for each included operator
+    work.subset.resize(0);
+    local::play::const_sequential_iterator itr = play_.begin();
+    local::op_code_var op;
+    const addr_t*      arg;
+    size_t             i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+    const addr_t* arg_begin = arg;
+    while( op != local::EndOp )
+    {   if( op == local::CSumOp || op == local::CSkipOp )
+            itr.correct_before_increment();
+        (++itr).op_info(op, arg, i_var);
+        if( include[ itr.op_index() ] )
+        {   work.subset.push_back( itr.op_index() );
+            work.subset.push_back( size_t(arg - arg_begin) );
+            work.subset.push_back( i_var );
+        }
+    }
+    return;
+}
+// ----------------------------------------------------------------------------
+/*!
+Zero order forward mode that only recomputes what has changed.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\param x
+a vector of length n, the new value for the independent variables.
+The components with index not in change must be equal to their previous
+value (they are used when all the operators are evaluated).
+
+\param change
+the indices of the independent variables that have changed since the
+previous zero order forward calculation.
+
+\param work
+the subset of operators that depend on change.
+
+\return
+the value of the dependent variables (a vector of length m).
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+template <class BaseVector, class SizeVector>
+BaseVector ADFun<Base,RecBase>::forward_change(
+    const BaseVector&    x      ,
+    const SizeVector&    change ,
+    forward_change_work& work   )
+// END_PROTOTYPE
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+    //
+    // n, m
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    //
+    // check BaseVector and SizeVector are Simple Vector classes
+    CheckSimpleVector<Base, BaseVector>();
+    CheckSimpleVector<size_t, SizeVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "forward_change: size of x not equal domain dimension for f"
+    );
+    //
+    // full
+    // cases where the previous Taylor coefficients can not be used
+    bool full = num_order_taylor_ == 0;
+    full     |= num_direction_taylor_ != 1;
+    full     |= play_.num_var_vecad() > 0;
+    if( full )
+        return Forward(0, x);
+    //
+    // work.flag
+    work.flag.resize(n);
+    for(size_t j = 0; j < n; ++j)
+        work.flag[j] = false;
+    for(size_t k = 0; k < size_t( change.size() ); ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            change[k] < n,
+            "forward_change: an element of change is >= domain dimension"
+        );
+        work.flag[ change[k] ] = true;
+    }
+    //
+    // same
+    // is this the same selection as the previous call
+    bool same = work.select.size() == n;
+    same     &= work.info.n_op() == play_.num_var_op();
+    for(size_t j = 0; j < n && same; ++j)
+        same = work.select[j] == work.flag[j];
+    //
+    // work.select, work.subset, work.full
+    if( ! same )
+    {   work.select.swap( work.flag );
+        switch( play_.address_type() )
+        {
+            case local::play::unsigned_short_enum:
+            forward_change_subset<unsigned short>(work);
+            break;
+
+            case local::play::addr_t_enum:
+            forward_change_subset<addr_t>(work);
+            break;
+
+            case local::play::size_t_enum:
+            forward_change_subset<size_t>(work);
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+        }
+    }
+    if( work.full )
+        return Forward(0, x);
+    //
+    // taylor_
+    // zero order coefficients for the independent variables that changed
+    size_t C = cap_order_taylor_;
+    for(size_t k = 0; k < size_t( change.size() ); ++k)
+    {   size_t j = change[k];
+        CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+        taylor_[ C * ind_taddr_[j] ] = x[j];
+    }
+    //
+    // taylor_
+    // zero order forward for the subset of operators
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
+    local::sweep::profile* profile = nullptr;
+    if( sweep_profile_on_ )
+        profile = &sweep_profile_;
+    bool print = true;
+    local::sweep::forward_0(
+        not_used_rec_base,
+        &play_,
+        num_var_tape_,
+        C,
+        cskip_op_.data(),
+        load_op2var_,
+        compare_change_count_,
+        compare_change_number_,
+        compare_change_op_index_,
+        std::cout,
+        print,
+        taylor_.data(),
+        atomic_parallel_,
+        profile,
+        &work.subset
+    );
+    //
+    // y
+    BaseVector y(m);
+    for(size_t i = 0; i < m; ++i)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        y[i] = taylor_[ C * dep_taddr_[i] ];
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(y) && check_for_nan_ ) ,
+        "f.forward_change(x, change, work): y has a nan"
+    );
+    //
+    // now we have one taylor_ coefficient order per variable
+    num_order_taylor_ = 1;
+    //
+    return y;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,194 @@
+# ifndef CPPAD_CORE_FUN_COMPOSE_HPP
+# define CPPAD_CORE_FUN_COMPOSE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin fun_compose}
+
+Compose Two ADFun Objects Into One
+##################################
+
+Syntax
+******
+| *h* . ``compose`` ( *g* , *f* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+This sets *h* to the composition :math:`h(x) = g[ f(x) ]`
+by copying the operation sequence for *g* to the end of the operation
+sequence for *f* ; i.e., the code used to record *f* and *g*
+is not run again.
+This is different from using *f* as a :ref:`chkpoint_two-name`
+function when recording *g* because the operations in *f* and *g*
+are in the same operation sequence.
+Hence :ref:`optimize-name` can combine operations in *f* and *g*
+and there is no atomic function call overhead during the sweeps.
+
+f
+*
+This is the inner function. It must contain an operation sequence;
+i.e., it is not empty.
+We use *n* for the domain size of *f* and *m* for its range size.
+
+g
+*
+This is the outer function. It must contain an operation sequence
+and its domain size must be *m* .
+We use *r* for the range size of *g* .
+
+h
+*
+The input contents of *h* do not matter.
+Upon return, its domain size is *n* and its range size is *r* .
+The zero order Taylor coefficients are not computed; i.e.,
+:ref:`size_order-name` is zero for *h* .
+The object *h* may be the same as *f* or *g* .
+
+Dynamic Parameters
+******************
+We use *p_f* ( *p_g* ) for the independent dynamic parameters in
+*f* ( *g* ) .
+The independent dynamic parameter vector for *h* is
+( *p_f* , *p_g* ) .
+The initial values of these dynamic parameters are their values in
+*f* and *g* .
+
+Optimization
+************
+The operation sequences for *f* and *g* are copied as they are.
+Common subexpressions in *f* and *g* are not combined,
+and operations in *f* that are not needed to compute *h*
+are not removed, unless *h* is :ref:`optimized<optimize-name>` .
+
+{xrst_toc_hidden
+    example/general/fun_compose.cpp
+}
+Example
+*******
+The file :ref:`fun_compose.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end fun_compose}
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fun_compose.hpp
+Compose two ADFun objects into one.
+*/
+
+/*!
+Set this function to the composition of two functions.
+
+\param g
+is the outer function.
+
+\param f
+is the inner function. The range size of f must equal the domain size of g.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::compose(
+    const ADFun<Base,RecBase>& g ,
+    const ADFun<Base,RecBase>& f )
+// END_PROTOTYPE
+{   CPPAD_ASSERT_KNOWN( f.size_var() > 0 && g.size_var() > 0,
+        "compose: f or g is empty"
+    );
+    CPPAD_ASSERT_KNOWN( f.Range() == g.Domain(),
+        "compose: range size of f not equal domain size of g"
+    );
+    //
+    // n_var, n_ran, d_f, d_g
+    size_t n_var = f.Domain();
+    size_t n_ran = g.Range();
+    size_t d_f   = f.size_dyn_ind();
+    size_t d_g   = g.size_dyn_ind();
+    //
+    // nan
+    Base nan = CppAD::numeric_limits<Base>::quiet_NaN();
+    //
+    // rec
+    // start a new recording
+    local::recorder<Base> rec;
+    rec.set_n_dyn_independent(d_f + d_g);
+    rec.set_abort_op_index(0);
+    rec.set_record_compare(true);
+    //
+    // rec
+    // reserve memory for the operators in f and g
+    rec.reserve( f.size_op() + g.size_op() );
+    //
+    // rec
+    // parameter with index zero is nan, variable with index zero is BeginOp
+    addr_t par_addr = rec.put_con_par(nan);
+    CPPAD_ASSERT_UNKNOWN( par_addr == 0 );
+    CPPAD_ASSERT_NARG_NRES(local::BeginOp, 1, 1);
+    rec.PutOp(local::BeginOp);
+    rec.PutArg(par_addr);
+    //
+    // rec, dyn_ind_f, dyn_ind_g
+    // independent dynamic parameters
+    local::pod_vector<addr_t> dyn_ind_f(d_f), dyn_ind_g(d_g);
+    for(size_t j = 0; j < d_f; ++j)
+    {   Base par = f.play_.par_one( f.play_.dyn2par_index()[j] );
+        dyn_ind_f[j] = rec.put_dyn_par(par, local::ind_dyn);
+        CPPAD_ASSERT_UNKNOWN( size_t( dyn_ind_f[j] ) == j + 1 );
+    }
+    for(size_t j = 0; j < d_g; ++j)
+    {   Base par = g.play_.par_one( g.play_.dyn2par_index()[j] );
+        dyn_ind_g[j] = rec.put_dyn_par(par, local::ind_dyn);
+        CPPAD_ASSERT_UNKNOWN( size_t( dyn_ind_g[j] ) == d_f + j + 1 );
+    }
+    //
+    // rec, var_ind
+    // independent variables
+    local::pod_vector<addr_t> var_ind(n_var);
+    for(size_t j = 0; j < n_var; ++j)
+    {   var_ind[j] = rec.PutOp(local::InvOp);
+        CPPAD_ASSERT_UNKNOWN( size_t( var_ind[j] ) == j + 1 );
+    }
+    //
+    // rec, var_ind
+    // copy f and map the independent variables for g to the
+    // dependent variables for f
+    local::pod_vector<addr_t> var_map;
+    rec.put_player(f.play_, dyn_ind_f, var_ind, var_map);
+    var_ind.resize( f.Range() );
+    for(size_t j = 0; j < f.Range(); ++j)
+        var_ind[j] = var_map[ f.dep_taddr_[j] ];
+    //
+    // rec, dep_taddr, dep_parameter
+    // copy g
+    rec.put_player(g.play_, dyn_ind_g, var_ind, var_map);
+    local::pod_vector<size_t> dep_taddr(n_ran);
+    local::pod_vector<bool>   dep_parameter(n_ran);
+    for(size_t i = 0; i < n_ran; ++i)
+    {   dep_taddr[i]     = size_t( var_map[ g.dep_taddr_[i] ] );
+        dep_parameter[i] = g.dep_parameter_[i];
+    }
+    //
+    // rec
+    rec.PutOp(local::EndOp);
+    //
+    // private data for this object
+    // (f and g are no longer used so this object can be f or g)
+    dep_taddr_.swap(dep_taddr);
+    dep_parameter_.swap(dep_parameter);
+    set_recording(rec, n_var);
+    //
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
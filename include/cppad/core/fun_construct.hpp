@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FUN_CONSTRUCT_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin fun_construct}
@@ -246,6 +246,8 @@ function_name_(""),
 exceed_collision_limit_(false),
 has_been_optimized_(false),
 check_for_nan_(true) ,
+sweep_profile_on_(false) ,
+atomic_parallel_(nullptr) ,
 compare_change_count_(0),
 compare_change_number_(0),
 compare_change_op_index_(0),
@@ -296,6 +298,10 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     exceed_collision_limit_    = f.exceed_collision_limit_;
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    sweep_profile_on_          = f.sweep_profile_on_;
+    //
+    // function pointers
+    atomic_parallel_           = f.atomic_parallel_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -320,6 +326,9 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     // player
     play_                      = f.play_;
     //
+    // profile
+    sweep_profile_             = f.sweep_profile_;
+    //
     // subgraph
     subgraph_info_             = f.subgraph_info_;
     //
@@ -340,6 +349,10 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     std::swap( exceed_collision_limit_    , f.exceed_collision_limit_);
     std::swap( has_been_optimized_        , f.has_been_optimized_);
     std::swap( check_for_nan_             , f.check_for_nan_);
+    std::swap( sweep_profile_on_          , f.sweep_profile_on_);
+    //
+    // function pointers
+    std::swap( atomic_parallel_           , f.atomic_parallel_);
     //
     // size_t objects
     std::swap( compare_change_count_      , f.compare_change_count_);
@@ -361,6 +374,9 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     // player
     play_.swap(f.play_);
     //
+    // profile
+    sweep_profile_.swap(f.sweep_profile_);
+    //
     // subgraph_info
     subgraph_info_.swap(f.subgraph_info_);
     //
@@ -460,6 +476,9 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
 
     // ad_fun.hpp member values not set by dependent
     check_for_nan_       = true;
+    sweep_profile_on_    = false;
+    atomic_parallel_     = nullptr;
+    sweep_profile_.clear();
 
     // allocate memory for one zero order taylor_ coefficient
     CPPAD_ASSERT_UNKNOWN( num_order_taylor_ == 0 );
@@ -494,7 +513,10 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
         compare_change_op_index_,
         std::cout,
         print,
-        taylor_.data()
+        taylor_.data(),
+        atomic_parallel_,
+        nullptr,
+        nullptr
     );
     CPPAD_ASSERT_UNKNOWN( compare_change_count_    == 1 );
     CPPAD_ASSERT_UNKNOWN( compare_change_number_   == 0 );
@@ -0,0 +1,380 @@
+# ifndef CPPAD_CORE_FUN_SPLICE_HPP
+# define CPPAD_CORE_FUN_SPLICE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin fun_splice}
+{xrst_spell
+    dyn
+}
+
+Splice Functions Together Into One ADFun Object
+###############################################
+
+Syntax
+******
+| *h* . ``splice`` ( *fun_vec* , *var_index* , *dyn_index* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+Recording a large function can take a long time.
+If the function consists of pieces that can be recorded separately,
+each piece can be recorded as its own ``ADFun`` object; e.g.,
+using a different thread for each piece; see :ref:`ta_parallel_setup-name` .
+This routine splices the pieces into one ``ADFun`` object.
+It copies the operation sequence for each piece directly; i.e.,
+the code used to record the pieces is not run again.
+
+Notation
+********
+
+.. list-table::
+    :widths: auto
+
+    * - *K*
+      - the number of pieces; i.e., *fun_vec* . ``size`` ()
+    * - *f_k*
+      - the function *fun_vec* [ *k* ] for *k* = 0 , ... , *K* - 1
+    * - *n_k*
+      - the domain size for *f_k*
+    * - *m_k*
+      - the range size for *f_k*
+    * - *d_k*
+      - the number of independent dynamic parameters for *f_k* ;
+        see :ref:`fun_property@size_dyn_ind`
+
+fun_vec
+*******
+is the vector of pieces that are spliced together.
+Each piece must contain an operation sequence; i.e.,
+it is not empty.
+
+var_index
+*********
+The *SizeVector* type must be a :ref:`SimpleVector-name` class
+with elements of type ``size_t`` .
+The vector *var_index* has size *n_0* + ... + *n_{K-1}* .
+The *j*-th independent variable for *f_k* is the independent variable
+for *h* with index
+*var_index* [ *n_0* + ... + *n_{k-1}* + *j* ] .
+The domain size for *h* is one plus the maximum element of *var_index* .
+Each index less than the domain size must appear at least once.
+An index can appear more than once; i.e.,
+pieces can share independent variables.
+
+dyn_index
+*********
+The vector *dyn_index* has size *d_0* + ... + *d_{K-1}* .
+The *j*-th independent dynamic parameter for *f_k* is the
+independent dynamic parameter for *h* with index
+*dyn_index* [ *d_0* + ... + *d_{k-1}* + *j* ] .
+The number of independent dynamic parameters for *h* is one plus
+the maximum element of *dyn_index* (zero if *dyn_index* is empty).
+Each index less than this number must appear at least once.
+The value of an independent dynamic parameter in *h* is its value in the
+first piece that uses it.
+
+h
+*
+The input contents of *h* do not matter.
+The object *h* may be one of the elements of *fun_vec* .
+Upon return, its range vector is
+( *y_0* , ... , *y_{K-1}* ) where
+*y_k* is the range vector for *f_k* evaluated at the independent variables
+and dynamic parameters specified by *var_index* and *dyn_index* .
+The zero order Taylor coefficients are not computed; i.e.,
+:ref:`size_order-name` is zero for *h* .
+
+Parameters
+**********
+The constant parameters in the pieces are merged;
+i.e., a constant that appears in more than one piece appears once in *h* .
+The dependent dynamic parameters in the pieces are copied to *h* .
+
+Optimization
+************
+The pieces are copied as they are.
+Common subexpressions in different pieces are not combined unless
+*h* is :ref:`optimized<optimize-name>` .
+
+{xrst_toc_hidden
+    example/general/fun_splice.cpp
+}
+Example
+*******
+The file :ref:`fun_splice.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end fun_splice}
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fun_splice.hpp
+Splice functions together into one ADFun object.
+*/
+
+/*!
+Set the private data in this object that corresponds to a new recording.
+
+\param rec [in,out]
+is the recording. It contains the BeginOp, the independent variables,
+the operation sequence, and the EndOp. Upon return, it has been erased;
+i.e., moved to the player for this object.
+
+\param n_ind
+is the number of independent variables in rec.
+
+\par
+The dep_taddr_ and dep_parameter_ vectors must have been set before calling
+this routine.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::set_recording(
+    local::recorder<Base>& rec   ,
+    size_t                 n_ind )
+{   //
+    // bool values in this object except check_for_nan_
+    has_been_optimized_        = false;
+    //
+    // size_t values in this object
+    compare_change_count_      = 1;
+    compare_change_number_     = 0;
+    compare_change_op_index_   = 0;
+    num_order_taylor_          = 0;
+    cap_order_taylor_          = 0;
+    num_direction_taylor_      = 0;
+    num_var_tape_              = rec.num_var();
+    //
+    // taylor_
+    taylor_.resize(0);
+    //
+    // cskip_op_
+    cskip_op_.resize( rec.num_var_op() );
+    //
+    // load_op2var_
+    load_op2var_.resize( rec.num_var_load() );
+    //
+    // play_
+    play_.get_recording(rec, n_ind);
+    //
+    // ind_taddr_
+    ind_taddr_.resize(n_ind);
+    CPPAD_ASSERT_UNKNOWN( n_ind < num_var_tape_);
+    for(size_t j = 0; j < n_ind; j++)
+    {   CPPAD_ASSERT_UNKNOWN( play_.GetOp(j+1) == local::InvOp );
+        ind_taddr_[j] = j+1;
+    }
+    //
+    // for_jac_sparse_pack_, for_jac_sparse_set_
+    for_jac_sparse_pack_.resize(0, 0);
+    for_jac_sparse_set_.resize(0,0);
+    //
+    // subgraph_info_
+    subgraph_info_.resize(
+        ind_taddr_.size(),   // n_ind
+        dep_taddr_.size(),   // n_dep
+        play_.num_var_op(),  // n_op
+        play_.num_var()      // n_var
+    );
+    //
+    // function_name_
+    function_name_ = "";
+}
+
+/*!
+Splice functions together into one ADFun object.
+
+\param fun_vec
+is the vector of pieces that are spliced together.
+
+\param var_index
+maps the independent variables for each piece to the independent
+variables for this function.
+
+\param dyn_index
+maps the independent dynamic parameters for each piece to the independent
+dynamic parameters for this function.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+template <class SizeVector>
+void ADFun<Base,RecBase>::splice(
+    const std::vector< ADFun<Base,RecBase> >& fun_vec   ,
+    const SizeVector&                         var_index ,
+    const SizeVector&                         dyn_index )
+// END_PROTOTYPE
+{   // check SizeVector is Simple Vector class with size_t elements
+    CheckSimpleVector<size_t, SizeVector>();
+    //
+    // n_fun, n_var, n_dyn
+    size_t n_fun = fun_vec.size();
+    size_t n_var = 0;
+    size_t n_dyn = 0;
+    size_t sum_var = 0;
+    size_t sum_dyn = 0;
+    for(size_t k = 0; k < n_fun; ++k)
+    {   CPPAD_ASSERT_KNOWN( fun_vec[k].size_var() > 0,
+            "splice: one of the functions in fun_vec is empty"
+        );
+        sum_var += fun_vec[k].Domain();
+        sum_dyn += fun_vec[k].size_dyn_ind();
+    }
+    CPPAD_ASSERT_KNOWN( size_t( var_index.size() ) == sum_var,
+        "splice: var_index size is not the sum of the domain sizes"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( dyn_index.size() ) == sum_dyn,
+        "splice: dyn_index size is not the sum of the "
+        "number of independent dynamic parameters"
+    );
+    for(size_t j = 0; j < sum_var; ++j)
+        n_var = std::max(n_var, var_index[j] + 1);
+    for(size_t j = 0; j < sum_dyn; ++j)
+        n_dyn = std::max(n_dyn, dyn_index[j] + 1);
+    CPPAD_ASSERT_KNOWN( n_var > 0,
+        "splice: the spliced function has no independent variables"
+    );
+# ifndef NDEBUG
+    {   vector<bool> found(n_var);
+        for(size_t j = 0; j < n_var; ++j)
+            found[j] = false;
+        for(size_t j = 0; j < sum_var; ++j)
+            found[ var_index[j] ] = true;
+        for(size_t j = 0; j < n_var; ++j) CPPAD_ASSERT_KNOWN( found[j],
+            "splice: an index less than the domain size is not in var_index"
+        );
+        found.resize(n_dyn);
+        for(size_t j = 0; j < n_dyn; ++j)
+            found[j] = false;
+        for(size_t j = 0; j < sum_dyn; ++j)
+            found[ dyn_index[j] ] = true;
+        for(size_t j = 0; j < n_dyn; ++j) CPPAD_ASSERT_KNOWN( found[j],
+            "splice: an index less than the number of "
+            "independent dynamic parameters is not in dyn_index"
+        );
+    }
+# endif
+    //
+    // nan
+    Base nan = CppAD::numeric_limits<Base>::quiet_NaN();
+    //
+    // dyn_value
+    // value of each independent dynamic parameter in first piece that uses it
+    vector<Base> dyn_value(n_dyn);
+    vector<bool> dyn_set(n_dyn);
+    for(size_t i = 0; i < n_dyn; ++i)
+        dyn_set[i] = false;
+    sum_dyn = 0;
+    for(size_t k = 0; k < n_fun; ++k)
+    {   const local::player<Base>& play = fun_vec[k].play_;
+        size_t d_k = play.n_dyn_independent();
+        for(size_t j = 0; j < d_k; ++j)
+        {   size_t i = dyn_index[sum_dyn + j];
+            if( ! dyn_set[i] )
+            {   dyn_set[i]    = true;
+                dyn_value[i]  = play.par_one( play.dyn2par_index()[j] );
+            }
+        }
+        sum_dyn += d_k;
+    }
+    //
+    // rec
+    // start a new recording
+    local::recorder<Base> rec;
+    rec.set_n_dyn_independent(n_dyn);
+    rec.set_abort_op_index(0);
+    rec.set_record_compare(true);
+    //
+    // rec
+    // reserve memory for the operators in all the pieces
+    size_t n_op = 1 + n_var + 1;
+    for(size_t k = 0; k < n_fun; ++k)
+        n_op += fun_vec[k].size_op();
+    rec.reserve(n_op);
+    //
+    // rec
+    // parameter with index zero is nan, variable with index zero is BeginOp
+    addr_t par_addr = rec.put_con_par(nan);
+    CPPAD_ASSERT_UNKNOWN( par_addr == 0 );
+    CPPAD_ASSERT_NARG_NRES(local::BeginOp, 1, 1);
+    rec.PutOp(local::BeginOp);
+    rec.PutArg(par_addr);
+    //
+    // rec
+    // independent dynamic parameters
+    for(size_t i = 0; i < n_dyn; ++i)
+    {   par_addr = rec.put_dyn_par(dyn_value[i], local::ind_dyn);
+        CPPAD_ASSERT_UNKNOWN( size_t(par_addr) == i + 1 );
+    }
+    //
+    // rec
+    // independent variables
+    for(size_t j = 0; j < n_var; ++j)
+    {
+# ifndef NDEBUG
+        addr_t var_addr = rec.PutOp(local::InvOp);
+        CPPAD_ASSERT_UNKNOWN( size_t(var_addr) == j + 1 );
+# else
+        rec.PutOp(local::InvOp);
+# endif
+    }
+    //
+    // rec, dep_taddr, dep_parameter
+    // copy the pieces
+    local::pod_vector<size_t> dep_taddr;
+    local::pod_vector<bool>   dep_parameter;
+    local::pod_vector<addr_t> dyn_ind, var_ind, var_map;
+    sum_var = 0;
+    sum_dyn = 0;
+    for(size_t k = 0; k < n_fun; ++k)
+    {   const ADFun& f_k = fun_vec[k];
+        //
+        // dyn_ind
+        size_t d_k = f_k.size_dyn_ind();
+        dyn_ind.resize(d_k);
+        for(size_t j = 0; j < d_k; ++j)
+            dyn_ind[j] = addr_t( dyn_index[sum_dyn + j] + 1 );
+        sum_dyn += d_k;
+        //
+        // var_ind
+        size_t n_k = f_k.Domain();
+        var_ind.resize(n_k);
+        for(size_t j = 0; j < n_k; ++j)
+            var_ind[j] = addr_t( var_index[sum_var + j] + 1 );
+        sum_var += n_k;
+        //
+        // rec, var_map
+        rec.put_player(f_k.play_, dyn_ind, var_ind, var_map);
+        //
+        // dep_taddr, dep_parameter
+        size_t m_k = f_k.Range();
+        for(size_t i = 0; i < m_k; ++i)
+        {   dep_taddr.push_back( size_t( var_map[ f_k.dep_taddr_[i] ] ) );
+            dep_parameter.push_back( f_k.dep_parameter_[i] );
+        }
+    }
+    //
+    // rec
+    rec.PutOp(local::EndOp);
+    //
+    // private data for this object
+    // (the pieces are no longer used so this object can be a piece)
+    dep_taddr_.swap(dep_taddr);
+    dep_parameter_.swap(dep_parameter);
+    set_recording(rec, n_var);
+    //
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
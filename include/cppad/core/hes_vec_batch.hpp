@@ -0,0 +1,356 @@
+# ifndef CPPAD_CORE_HES_VEC_BATCH_HPP
+# define CPPAD_CORE_HES_VEC_BATCH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin hes_vec_batch}
+{xrst_spell
+    hv
+    krylov
+}
+
+Hessian Times a Batch of Vectors
+################################
+
+Syntax
+******
+| ``hes_vec_work`` < *Base* > *work*
+| *f* . ``hes_vec_batch`` ( *x* , *w* , *v* , *hv* , *work* )
+| *work* . ``clear`` ()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+We use :math:`F : \B{R}^n \rightarrow \B{R}^m` to denote the
+:ref:`glossary@AD Function` corresponding to *f* ,
+:math:`H(x)` to denote the Hessian of :math:`w^\R{T} F(x)` ,
+and :math:`V \in \B{R}^{n \times r}` to denote the matrix
+with elements :math:`V_{j,\ell} = v[ r * j + \ell ]` .
+This routine computes :math:`H(x) V`; i.e.,
+the Hessian times *r* vectors.
+This is useful when many Hessian vector products are required;
+e.g., by a Newton-Krylov method.
+
+Method
+******
+This is the same as the following calls for each direction
+:math:`\ell = 0, \ldots , r-1`:
+
+| |tab| *f* . ``Forward`` (0, *x* )
+| |tab| *f* . ``Forward`` (1, *v_ell* )
+| |tab| *dw* = *f* . ``Reverse`` (2, *w* )
+
+where *v_ell* is the *ell*-th column of :math:`V` .
+On the other hand,
+the zero order forward sweep is only done once
+(and not at all if *x* is the same as in the previous call),
+the first order forward sweep is done for all the directions at once using
+:ref:`Forward(1, r, v)<forward_dir-name>` ,
+and the second order reverse sweep is done for all the directions
+with one pass through the operation sequence.
+The memory for the Taylor coefficients in *f* is only allocated
+when *r* is different from the previous call.
+
+f
+*
+This is the ``ADFun`` object for the function :math:`F(x)` .
+Note that *f* is not ``const``; see :ref:`hes_vec_batch@Uses Forward`
+below.
+
+x
+*
+This is the point at which the Hessian is evaluated.
+Its size is *n* .
+
+w
+*
+This is the vector that defines the weighting of the
+components of :math:`F(x)` in the Hessian.
+Its size is *m* .
+
+v
+*
+This is the matrix :math:`V` in row major order.
+Its size is *n* * *r* , where *r* is the number of vectors
+that are multiplied by the Hessian.
+The number of vectors *r* must be greater than zero.
+
+hv
+**
+The input value of its elements does not matter.
+Upon return, its size is *n* * *r* and
+for :math:`j = 0 , \ldots , n-1` and :math:`\ell = 0 , \ldots , r-1` ,
+
+.. math::
+
+    hv[ r * j + \ell ] = [ H(x) V ]_{j,\ell}
+
+work
+****
+This structure holds the memory used by the reverse sweep.
+If it is used with the same *f* and *r* , no memory is allocated for
+the reverse sweep.
+If *r* is greater than one, the reverse sweep needs the zero and
+first order Taylor coefficients for each direction next to each other,
+so they are copied to *work* .
+The memory can be freed using *work* . ``clear`` () .
+
+Uses Forward
+************
+After each call to :ref:`Forward-name` ,
+the object *f* contains the corresponding
+:ref:`Taylor coefficients<glossary@Taylor Coefficient>` .
+After a call to ``hes_vec_batch`` ,
+the zero order coefficients correspond to
+
+    *f* . ``Forward`` (0, *x* )
+
+and the first order coefficients correspond to
+
+    *f* . ``Forward`` (1, *r* , *v* )
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/hes_vec_batch.cpp
+}
+The file :ref:`hes_vec_batch.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end hes_vec_batch}
+*/
+# include <cppad/local/pod_vector.hpp>
+
+/*!
+\file hes_vec_batch.hpp
+Hessian times a batch of vectors.
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+Class used to hold the memory used by hes_vec_batch,
+so it does not need to be allocated every time.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+*/
+template <class Base>
+class hes_vec_work {
+    public:
+        /// Taylor coefficients for each direction (orders zero and one)
+        local::pod_vector_maybe<Base> taylor;
+        /// partial derivatives for each direction (orders zero and one)
+        local::pod_vector_maybe<Base> partial;
+        //
+        /// constructor
+        hes_vec_work(void)
+        { }
+        /// free the memory in this work space
+        void clear(void)
+        {   taylor.clear();
+            partial.clear();
+        }
+};
+// ----------------------------------------------------------------------------
+/*!
+Compute the Hessian of w^T F(x) times a batch of vectors.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\param x
+a vector of length n, the point at which the Hessian is evaluated.
+
+\param w
+a vector of length m, the weighting for the components of F(x).
+
+\param v
+a vector of length n * r, the matrix V in row major order.
+
+\param hv
+The input value of its elements does not matter.
+Upon return it has size n * r and contains H(x) V in row major order.
+
+\param work
+memory used by the reverse sweep.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+template <class BaseVector>
+void ADFun<Base,RecBase>::hes_vec_batch(
+    const BaseVector&   x     ,
+    const BaseVector&   w     ,
+    const BaseVector&   v     ,
+    BaseVector&         hv    ,
+    hes_vec_work<Base>& work  )
+// END_PROTOTYPE
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+    //
+    // n, m
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    //
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "hes_vec_batch: size of x not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "hes_vec_batch: size of w not equal range dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        v.size() > 0 && size_t(v.size()) % n == 0,
+        "hes_vec_batch: size of v is zero or not a multiple of\n"
+        "the domain dimension for f"
+    );
+    //
+    // r
+    size_t r = size_t(v.size()) / n;
+    //
+    // same_x
+    // are the zero order coefficients in taylor_ for this x and
+    // is taylor_ already set up for first order in r directions
+    // (after the ADFun constructor the capacity is only one order)
+    size_t per_var = 0;
+    bool   same_x  = num_order_taylor_ > 0 && num_direction_taylor_ == r;
+    same_x        &= cap_order_taylor_ >= 2;
+    if( same_x )
+    {   per_var = (cap_order_taylor_ - 1) * r + 1;
+        for(size_t j = 0; j < n; ++j)
+            same_x &= taylor_[ ind_taddr_[j] * per_var ] == x[j];
+    }
+    //
+    // taylor_
+    // zero order for x. Unlike Forward(0, x), this does not change the
+    // number of directions, so taylor_ is only allocated when r changes.
+    local::sweep::profile* profile = nullptr;
+    if( sweep_profile_on_ )
+        profile = &sweep_profile_;
+    if( ! same_x )
+    {   if( cap_order_taylor_ < 2 || num_direction_taylor_ != r )
+        {   num_order_taylor_ = 0;
+            capacity_order( std::max<size_t>(2, cap_order_taylor_), r);
+        }
+        per_var = (cap_order_taylor_ - 1) * r + 1;
+        for(size_t j = 0; j < n; ++j)
+            taylor_[ ind_taddr_[j] * per_var ] = x[j];
+        CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
+        CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
+        bool print = true;
+        local::sweep::forward_0(
+            not_used_rec_base,
+            &play_,
+            num_var_tape_,
+            per_var,
+            cskip_op_.data(),
+            load_op2var_,
+            compare_change_count_,
+            compare_change_number_,
+            compare_change_op_index_,
+            std::cout,
+            print,
+            taylor_.data(),
+            atomic_parallel_,
+            profile,
+            nullptr
+        );
+        num_order_taylor_ = 1;
+    }
+    //
+    // taylor_
+    // first order for each column of V (no allocation)
+    Forward(1, r, v);
+    CPPAD_ASSERT_UNKNOWN( num_direction_taylor_ == r );
+    CPPAD_ASSERT_UNKNOWN( per_var == (cap_order_taylor_ - 1) * r + 1 );
+    //
+    // taylor_all, cap_order, taylor_stride
+    // Taylor coefficients used by the reverse sweep. If r is one, the
+    // reverse sweep uses taylor_ directly. Otherwise the reverse sweep
+    // expects the orders for each variable and direction to be contiguous,
+    // so orders zero and one for each direction are gathered in work.taylor.
+    size_t      n_var_dir     = num_var_tape_ * 2;
+    const Base* taylor_all    = taylor_.data();
+    size_t      cap_order     = cap_order_taylor_;
+    size_t      taylor_stride = 0;
+    if( r > 1 )
+    {   work.taylor.resize(n_var_dir * r);
+        for(size_t ell = 0; ell < r; ++ell)
+        {   Base* taylor_ell = work.taylor.data() + ell * n_var_dir;
+            for(size_t i = 0; i < num_var_tape_; ++i)
+            {   taylor_ell[i * 2 + 0] = taylor_[i * per_var];
+                taylor_ell[i * 2 + 1] = taylor_[i * per_var + 1 + ell];
+            }
+        }
+        taylor_all    = work.taylor.data();
+        cap_order     = 2;
+        taylor_stride = n_var_dir;
+    }
+    //
+    // work.partial
+    // the partial of the first order coefficient of w^T F is w
+    work.partial.resize(n_var_dir * r);
+    for(size_t k = 0; k < n_var_dir * r; ++k)
+        work.partial[k] = Base(0.0);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   Base* partial_ell = work.partial.data() + ell * n_var_dir;
+        for(size_t i = 0; i < m; ++i)
+        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_ );
+            partial_ell[dep_taddr_[i] * 2 + 1] += w[i];
+        }
+    }
+    //
+    // work.partial
+    // second order reverse sweep for all the directions
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
+    local::play::const_sequential_iterator play_itr = play_.end();
+    size_t q = 2;
+    local::sweep::reverse(
+        num_var_tape_,
+        &play_,
+        cap_order,
+        taylor_all,
+        taylor_stride,
+        q,
+        r,
+        work.partial.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        play_itr,
+        not_used_rec_base,
+        profile
+    );
+    //
+    // hv
+    // partial of first order coefficient w.r.t. the zero order coefficient
+    hv.resize(n * r);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   const Base* partial_ell = work.partial.data() + ell * n_var_dir;
+        for(size_t j = 0; j < n; ++j)
+        {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+            hv[r * j + ell] = partial_ell[ind_taddr_[j] * 2 + 0];
+        }
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(hv) && check_for_nan_ ) ,
+        "f.hes_vec_batch(x, w, v, hv, work): hv has a nan,\n"
+        "but none of its Taylor coefficients are nan."
+    );
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_INDEPENDENT_INDEPENDENT_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/independent.hpp>
 
@@ -20,7 +20,9 @@ This implements :ref:`Independent-name` with all the possible arguments present.
 
 Syntax
 ******
-| ``Independent`` ( *x* , *abort_op_index* , *record_compare* , *dynamic* )
+| ``Independent`` (
+| |tab| *x* , *abort_op_index* , *record_compare* , *dynamic* , *reserve*
+| )
 
 Prototype
 *********
@@ -54,6 +56,11 @@ dynamic
 *******
 is the independent dynamic parameter vector.
 
+reserve
+*******
+is the number of variable operators to reserve memory for
+(zero corresponds to no reservation).
+
 {xrst_end independent_all}
 */
 // BEGIN_ALL_ARGUMENT
@@ -62,7 +69,8 @@ void Independent(
     ADVector&  x              ,
     size_t     abort_op_index ,
     bool       record_compare ,
-    ADVector&  dynamic        )
+    ADVector&  dynamic        ,
+    size_t     reserve        )
 // END_ALL_ARGUMENT
 {   CPPAD_ASSERT_KNOWN(
         abort_op_index == 0 || record_compare,
@@ -70,14 +78,77 @@ void Independent(
     );
     typedef typename ADVector::value_type ADBase;
     typedef typename ADBase::value_type   Base;
+    // do not use the tape_ptr() cache because this thread has not
+    // started a recording
     CPPAD_ASSERT_KNOWN(
-        ADBase::tape_ptr() == nullptr,
+        *ADBase::tape_handle( thread_alloc::thread_num() ) == nullptr,
         "Independent: cannot create a new tape because\n"
         "a previous tape is still active (for this thread).\n"
         "AD<Base>::abort_recording() would abort this previous recording."
     );
     local::ADTape<Base>* tape = ADBase::tape_manage(new_tape_manage);
-    tape->Independent(x, abort_op_index, record_compare, dynamic);
+    tape->Independent(x, abort_op_index, record_compare, dynamic, reserve);
+}
+/*
+----------------------------------------------------------------------------
+{xrst_begin independent_x_abort_record_dynamic dev}
+
+Independent: Default For reserve
+################################
+
+Purpose
+*******
+This implements :ref:`Independent-name` using
+the default for the reserve argument.
+
+Syntax
+******
+``Independent`` ( *x* , *abort_op_index* , *record_compare* , *dynamic* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_FOUR_ARGUMENT
+    // END_FOUR_ARGUMENT
+}
+
+Base
+****
+The base type the recording started by this operation.
+
+ADVector
+********
+is simple vector type with elements of type ``AD`` < *Base* > .
+
+x
+*
+is the vector of the independent variables.
+
+abort_op_index
+**************
+operator index at which execution will be aborted (during  the recording
+of operations). The value zero corresponds to not aborting (will not match).
+
+record_compare
+**************
+should comparison operators be recorded.
+
+dynamic
+*******
+is the independent dynamic parameter vector.
+
+{xrst_end independent_x_abort_record_dynamic}
+*/
+// BEGIN_FOUR_ARGUMENT
+template <class ADVector>
+void Independent(
+    ADVector&  x              ,
+    size_t     abort_op_index ,
+    bool       record_compare ,
+    ADVector&  dynamic        )
+// END_FOUR_ARGUMENT
+{   size_t reserve = 0;
+    Independent(x, abort_op_index, record_compare, dynamic, reserve);
 }
 /*
 ----------------------------------------------------------------------------
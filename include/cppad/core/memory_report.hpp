@@ -0,0 +1,185 @@
+# ifndef CPPAD_CORE_MEMORY_REPORT_HPP
+# define CPPAD_CORE_MEMORY_REPORT_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin memory_report}
+{xrst_spell
+    addr
+    dyn
+    ind
+    itr
+    taddr
+    vecad
+}
+
+Memory Used by Each Part of an ADFun Object
+###########################################
+
+Syntax
+******
+| *report* = *f* . ``memory_report`` ()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+The function :ref:`fun_property@size_op_seq` returns
+the total number of bytes required to store the operation sequence in *f* .
+This routine instead reports the number of bytes that are currently
+allocated for each of the parts of *f* .
+This can be used to determine which part of *f* to reduce;
+e.g., by :ref:`optimizing<optimize-name>` the operation sequence,
+reducing the :ref:`capacity_order-name` ,
+freeing sparsity patterns using
+:ref:`for_jac_sparsity@f@size_forward_bool` ,
+or freeing subgraph information using
+:ref:`subgraph_reverse@clear_subgraph` .
+
+f
+*
+This is the ``ADFun`` object that the report is for.
+
+report
+******
+Each element of *report* is a ``memory_report_record``
+which is defined by
+{xrst_literal
+    include/cppad/core/ad_fun.hpp
+    // BEGIN_MEMORY_REPORT_RECORD
+    // END_MEMORY_REPORT_RECORD
+}
+The *bytes* field uses the capacity (not the length) of the
+corresponding vector because this is the memory that is allocated.
+The *name* field is one of the following:
+
+.. csv-table::
+    :widths: auto
+    :header-rows: 1
+
+    name,                contents
+    var_op,              operators for the variables
+    var_arg,             arguments for the variable operators
+    var_text,            text used by :ref:`PrintFor-name` operators
+    var_vecad_ind,       :ref:`VecAD-name` vector information
+    random_itr_info,     random access information; see :ref:`fun_property@size_random`
+    skip_run,            runs of operators skipped by conditional skip operators
+    par_all,             values for all the parameters
+    par_is_dyn,          which parameters are dynamic
+    dyn2par_index,       parameter index for each dynamic parameter
+    dyn_par_op,          operators for the dynamic parameters
+    dyn_par_arg,         arguments for the dynamic parameter operators
+    taylor,              Taylor coefficients; see :ref:`capacity_order-name`
+    subgraph_partial,    partials used by :ref:`subgraph_reverse-name`
+    cskip_op,            which operators are skipped by conditional expressions
+    load_op2var,         results for :ref:`VecAD-name` load operators
+    ind_taddr,           tape address for each independent variable
+    dep_taddr,           tape address for each dependent variable
+    dep_parameter,       which dependent variables are parameters
+    for_jac_sparse_pack, forward Jacobian sparsity patterns stored as bits
+    for_jac_sparse_set,  forward Jacobian sparsity patterns stored as sets
+    subgraph_info,       information used by the subgraph routines
+    sweep_profile,       operator counts and times; see :ref:`sweep_profile-name`
+
+Tape Address Type
+*****************
+The operator arguments are stored using the
+:ref:`cmake@cppad_tape_addr_type` , which is chosen when CppAD is configured.
+The random access information (op2arg, op2var, var2op)
+uses the smallest of ``unsigned short`` , *tape_addr_type* , and
+``size_t`` that can hold all the indices for *f* .
+If the *var_arg* memory is significant and all your tapes are small,
+configuring with a smaller *tape_addr_type* reduces this memory
+and the memory traffic during sweeps.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/memory_report.cpp
+}
+The file :ref:`memory_report.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end memory_report}
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file memory_report.hpp
+Report the amount of memory used by each part of an ADFun object.
+*/
+
+/*!
+Report the amount of memory used by each part of an ADFun object.
+
+\return
+is a vector with one element for each part of this ADFun object.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+vector<memory_report_record> ADFun<Base,RecBase>::memory_report(void) const
+// END_PROTOTYPE
+{   vector<memory_report_record> report;
+    //
+    // operation sequence
+    play_.memory_report(report);
+    //
+    memory_report_record record;
+    //
+    record.name  = "taylor";
+    record.bytes = taylor_.capacity() * sizeof(Base);
+    report.push_back(record);
+    //
+    record.name  = "subgraph_partial";
+    record.bytes = subgraph_partial_.capacity() * sizeof(Base);
+    report.push_back(record);
+    //
+    record.name  = "cskip_op";
+    record.bytes = cskip_op_.capacity() * sizeof(bool);
+    report.push_back(record);
+    //
+    record.name  = "load_op2var";
+    record.bytes = load_op2var_.capacity() * sizeof(addr_t);
+    report.push_back(record);
+    //
+    record.name  = "ind_taddr";
+    record.bytes = ind_taddr_.capacity() * sizeof(size_t);
+    report.push_back(record);
+    //
+    record.name  = "dep_taddr";
+    record.bytes = dep_taddr_.capacity() * sizeof(size_t);
+    report.push_back(record);
+    //
+    record.name  = "dep_parameter";
+    record.bytes = dep_parameter_.capacity() * sizeof(bool);
+    report.push_back(record);
+    //
+    record.name  = "for_jac_sparse_pack";
+    record.bytes = for_jac_sparse_pack_.memory();
+    report.push_back(record);
+    //
+    record.name  = "for_jac_sparse_set";
+    record.bytes = for_jac_sparse_set_.memory();
+    report.push_back(record);
+    //
+    record.name  = "subgraph_info";
+    record.bytes = subgraph_info_.memory();
+    report.push_back(record);
+    //
+    record.name  = "sweep_profile";
+    record.bytes = sweep_profile_.memory();
+    report.push_back(record);
+    //
+    return report;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
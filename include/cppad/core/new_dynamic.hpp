@@ -2,7 +2,7 @@
 # define CPPAD_CORE_NEW_DYNAMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -14,6 +14,7 @@ Change the Dynamic Parameters
 Syntax
 ******
 | *f* . ``new_dynamic`` ( *dynamic* )
+| *f* . ``new_dynamic`` ( *dynamic* , *change* )
 
 Purpose
 *******
@@ -52,6 +53,25 @@ in the call to ``Independent`` that started
 the recording for *f* ; see
 :ref:`fun_property@size_dyn_ind` .
 
+change
+******
+If this argument is present, it has prototype
+
+    ``const`` *SizeVector* & *change*
+
+where *SizeVector* is a :ref:`SimpleVector-name` class with
+:ref:`elements of type<SimpleVector@Elements of Specified Type>`
+``size_t`` .
+It is the vector of indices for the components of *dynamic* that changed;
+each of its elements must be less than the size of *dynamic* .
+If an index *j* is not in *change* , *dynamic* [ *j* ] is not used and
+its value is assumed to be the same as in the previous call to
+``new_dynamic`` (or during the recording if there was no previous call).
+Only the dynamic parameters that depend on the components of *dynamic*
+in *change* are recomputed.
+This is much faster when there are many dynamic parameters
+and only a few of them change.
+
 BaseVector
 **********
 The type *BaseVector* must be a :ref:`SimpleVector-name` class with
@@ -118,7 +138,72 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
         dyn2par_index       ,
         dyn_par_op          ,
         dyn_par_arg         ,
-        not_used_rec_base
+        not_used_rec_base   ,
+        nullptr
+    );
+
+    // the existing Taylor coefficients are no longer valid
+    num_order_taylor_ = 0;
+
+    return;
+}
+/*!
+Change some of the dynamic parameters in this ADFun object
+
+\param dynamic
+is the vector of new values for the dynamic parameters.
+Only the components with index in change are used.
+
+\param change
+is the vector of indices for the independent dynamic parameters that
+changed. Only the dynamic parameters that depend on these are recomputed.
+*/
+template <class Base, class RecBase>
+template <class BaseVector, class SizeVector>
+void ADFun<Base,RecBase>::new_dynamic(
+    const BaseVector& dynamic ,
+    const SizeVector& change  )
+{   using local::pod_vector;
+    size_t n_dyn_ind = play_.n_dyn_independent();
+    CPPAD_ASSERT_KNOWN(
+        size_t( dynamic.size() ) == n_dyn_ind ,
+        "f.new_dynamic: dynamic.size() different from corresponding "
+        "call to Independent"
+    );
+    // check BaseVector and SizeVector are Simple Vector classes
+    CheckSimpleVector<Base, BaseVector>();
+    CheckSimpleVector<size_t, SizeVector>();
+
+    // select_ind
+    pod_vector<bool> select_ind(n_dyn_ind);
+    for(size_t j = 0; j < n_dyn_ind; ++j)
+        select_ind[j] = false;
+    for(size_t k = 0; k < size_t( change.size() ); ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            change[k] < n_dyn_ind,
+            "f.new_dynamic: an element of change is >= dynamic.size()"
+        );
+        select_ind[ change[k] ] = true;
+    }
+
+    // retrieve player information about the dynamic parameters
+    local::pod_vector_maybe<Base>&     par_all( play_.par_all() );
+    const pod_vector<bool>&            par_is_dyn ( play_.par_is_dyn()  );
+    const pod_vector<local::opcode_t>& dyn_par_op ( play_.dyn_par_op()  );
+    const pod_vector<addr_t>&          dyn_par_arg( play_.dyn_par_arg() );
+    const pod_vector<addr_t>&     dyn2par_index ( play_.dyn2par_index() );
+
+    // set the dynamic parameters that depend on change
+    RecBase not_used_rec_base(0.0);
+    local::sweep::dynamic(
+        par_all             ,
+        dynamic             ,
+        par_is_dyn          ,
+        dyn2par_index       ,
+        dyn_par_op          ,
+        dyn_par_arg         ,
+        not_used_rec_base   ,
+        &select_ind
     );
 
     // the existing Taylor coefficients are no longer valid
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_OPTIMIZE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # define CPPAD_CORE_OPTIMIZE_PRINT_RESULT 0
@@ -61,6 +61,11 @@ If conditional skip operations are generated,
 it may save a significant amount of time when
 using *f* for :ref:`forward-name` or :ref:`reverse-name` mode calculations;
 see :ref:`number_skip-name` .
+Zero order forward mode and reverse mode jump over each run of
+consecutive operators that is skipped in constant time.
+Hence the savings are greater when the operations for the
+*if_true* and *if_false* cases of a conditional expression
+are recorded separately (not interleaved).
 
 no_compare_op
 =============
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <algorithm>
@@ -83,6 +83,49 @@ for the independent variables as specified by previous calls to Forward.
 template <class Base, class RecBase>
 template <class BaseVector>
 BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
+{   size_t r = 1;
+    return Reverse(q, r, w);
+}
+/*!
+Use reverse mode to compute derivative of forward mode Taylor coefficients
+for multiple weight vectors.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD< Base > and computations by this routine are done using type
+ Base.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the number of the number of Taylor coefficients that are being
+differentiated (per variable).
+
+\param r
+is the number of weight vectors (directions).
+
+\param w
+If the argument w has size <tt>r * m * q</tt>,
+for ell = 0, ..., r-1, the weight vector for direction ell is
+the m * q elements of w starting at index ell * m * q.
+If the argument w has size <tt>r * m</tt>,
+for ell = 0, ..., r-1, the weight vector for direction ell is
+the m elements of w starting at index ell * m.
+In either case, the weight vector for direction ell has the same
+meaning as the argument w to Reverse(q, w).
+
+\return
+Is a vector dw with size <tt>r * n * q</tt>.
+For ell = 0, ..., r-1, the n * q elements starting at index ell * n * q
+are the same as the return value of Reverse(q, w) where w is the weight
+vector for direction ell.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::Reverse(
+    size_t q, size_t r, const BaseVector &w
+)
 {   // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base(0.0);
 
@@ -102,9 +145,14 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     CheckSimpleVector<Base, BaseVector>();
 
     CPPAD_ASSERT_KNOWN(
-        size_t(w.size()) == m || size_t(w.size()) == (m * q),
+        r > 0,
+        "The number of directions r in Reverse(q, r, w) is zero."
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == r * m || size_t(w.size()) == (r * m * q),
         "Argument w to Reverse does not have length equal to\n"
-        "the dimension of the range or dimension of range times q."
+        "the dimension of the range or dimension of range times q\n"
+        "(times the number of directions r)."
     );
     CPPAD_ASSERT_KNOWN(
         q > 0,
@@ -120,8 +168,8 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     if( (q == 1) && (num_direction_taylor_ > 1) )
     {   num_order_taylor_ = 1;        // number of orders to copy
         size_t c = cap_order_taylor_; // keep the same capacity setting
-        size_t r = 1;                 // only keep one direction
-        capacity_order(c, r);
+        size_t one = 1;               // only keep one direction
+        capacity_order(c, one);
     }
     CPPAD_ASSERT_KNOWN(
         num_direction_taylor_ == 1,
@@ -129,65 +177,86 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
         "\n(r > 1) is not yet supported for q > 1."
     );
 
+    // m_w: number of elements of w for each direction
+    // n_partial: number of elements of Partial for each direction
+    size_t m_w       = size_t(w.size()) / r;
+    size_t n_partial = num_var_tape_ * q;
+
     // initialize entire Partial matrix to zero
-    local::pod_vector_maybe<Base> Partial(num_var_tape_ * q);
-    for(i = 0; i < num_var_tape_; i++)
-        for(j = 0; j < q; j++)
-            Partial[i * q + j] = zero;
+    local::pod_vector_maybe<Base> Partial(n_partial * r);
+    for(i = 0; i < n_partial * r; i++)
+        Partial[i] = zero;
 
     // set the dependent variable direction
     // (use += because two dependent variables can point to same location)
-    if( size_t(w.size()) == m )
-    {   for(i = 0; i < m; ++i)
-        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
-            Partial[dep_taddr_[i] * q + q - 1] += w[i];
+    for(size_t ell = 0; ell < r; ++ell)
+    {   Base* partial_ell = Partial.data() + ell * n_partial;
+        if( m_w == m )
+        {   for(i = 0; i < m; ++i)
+            {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+                partial_ell[dep_taddr_[i] * q + q - 1] += w[ell * m + i];
+            }
         }
-    }
-    else
-    {   CPPAD_ASSERT_UNKNOWN( size_t(w.size()) == m * q );
-        for(i = 0; i < m; i++)
-        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
-            for(k = 0; k < q; k++)
-                Partial[ dep_taddr_[i] * q + k ] += w[i * q + k ];
+        else
+        {   CPPAD_ASSERT_UNKNOWN( m_w == m * q );
+            for(i = 0; i < m; i++)
+            {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+                for(k = 0; k < q; k++)
+                    partial_ell[ dep_taddr_[i] * q + k ] +=
+                        w[ (ell * m + i) * q + k ];
+            }
         }
     }
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
     local::play::const_sequential_iterator play_itr = play_.end();
+    local::sweep::profile* profile = nullptr;
+    if( sweep_profile_on_ )
+        profile = &sweep_profile_;
+    size_t taylor_stride = 0; // all directions use the same Taylor coefficients
     local::sweep::reverse(
         num_var_tape_,
         &play_,
         cap_order_taylor_,
         taylor_.data(),
+        taylor_stride,
         q,
+        r,
         Partial.data(),
         cskip_op_.data(),
         load_op2var_,
         play_itr,
-        not_used_rec_base
+        not_used_rec_base,
+        profile
     );
 
     // return the derivative values
-    BaseVector value(n * q);
-    for(j = 0; j < n; j++)
-    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
-
-        // independent variable taddr equals its operator taddr
-        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
-
-        // by the Reverse Identity Theorem
-        // partial of y^{(k)} w.r.t. u^{(0)} is equal to
-        // partial of y^{(q-1)} w.r.t. u^{(q - 1 - k)}
-        if( size_t(w.size()) == m )
-        {   for(k = 0; k < q; k++)
-                value[j * q + k ] =
-                    Partial[ind_taddr_[j] * q + q - 1 - k];
-        }
-        else
-        {   for(k = 0; k < q; k++)
-                value[j * q + k ] =
-                    Partial[ind_taddr_[j] * q + k];
+    BaseVector value(r * n * q);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   const Base* partial_ell = Partial.data() + ell * n_partial;
+        for(j = 0; j < n; j++)
+        {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+
+            // independent variable taddr equals its operator taddr
+            CPPAD_ASSERT_UNKNOWN(
+                play_.GetOp( ind_taddr_[j] ) == local::InvOp
+            );
+
+            // by the Reverse Identity Theorem
+            // partial of y^{(k)} w.r.t. u^{(0)} is equal to
+            // partial of y^{(q-1)} w.r.t. u^{(q - 1 - k)}
+            size_t index = (ell * n + j) * q;
+            if( m_w == m )
+            {   for(k = 0; k < q; k++)
+                    value[index + k] =
+                        partial_ell[ind_taddr_[j] * q + q - 1 - k];
+            }
+            else
+            {   for(k = 0; k < q; k++)
+                    value[index + k] =
+                        partial_ell[ind_taddr_[j] * q + k];
+            }
         }
     }
     CPPAD_ASSERT_KNOWN( ! ( hasnan(value) && check_for_nan_ ) ,
@@ -0,0 +1,291 @@
+# ifndef CPPAD_CORE_REVOLVE_REVERSE_HPP
+# define CPPAD_CORE_REVOLVE_REVERSE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin revolve_reverse app}
+{xrst_spell
+    griewank
+    walther
+}
+
+Reverse Mode Through Many Time Steps Using Binomial Checkpointing
+#################################################################
+
+Syntax
+******
+| *dw* = ``revolve_reverse`` ( *step* , *n_step* , *n_snap* , *x_0* , *w* , *x_N* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Reference
+*********
+Andreas Griewank and Andrea Walther,
+Algorithm 799: Revolve: An Implementation of Checkpointing for the Reverse
+or Adjoint Mode of Computational Differentiation,
+ACM Transactions on Mathematical Software, 2000.
+
+Purpose
+*******
+We are given a function :math:`S : \B{R}^n \rightarrow \B{R}^n`
+that advances a state vector one time step,
+and we define the states :math:`x^k \in \B{R}^n` by
+
+.. math::
+
+    x^{k+1} = S( x^k ) \; , \; k = 0 , \ldots , N-1
+
+We wish to compute the derivative of :math:`w^\R{T} x^N`
+with respect to :math:`x^0` .
+If all *N* steps are recorded in one ``ADFun`` object,
+the memory required is proportional to *N* .
+This routine instead records one step and stores at most
+*n_snap* states at a time.
+The states that are not stored are recomputed using the
+binomial checkpointing schedule in the reference above.
+This schedule minimizes the number of times *step* is evaluated
+for the given value of *n_snap* .
+
+Base
+****
+This is the base type for the step function.
+
+BaseVector
+**********
+The type *BaseVector* must be a
+:ref:`SimpleVector-name` class with elements of type *Base* .
+
+step
+****
+This is the function :math:`S(x)`.
+Its domain and range size must both be equal to *n* .
+Its zero order forward mode and first order reverse mode
+results are changed by this routine.
+
+n_step
+******
+This is the number of time steps :math:`N` .
+It must be greater than zero.
+
+n_snap
+******
+This is the maximum number of states, not counting :math:`x^0` ,
+that are stored at the same time; i.e., it is the memory budget.
+If it is zero, each state is recomputed starting from :math:`x^0` ;
+i.e., *step* is evaluated :math:`N (N - 1) / 2` times
+(not counting the evaluations at the time of the reverse mode
+calculation for each step).
+If it is greater than or equal to :math:`N - 1` ,
+*step* is evaluated :math:`N - 1` times
+(each state is computed once before the reverse mode calculations).
+In general, if *r* is the smallest integer such that
+
+.. math::
+
+    N \leq \left( \begin{array}{c} s + r \\ r \end{array} \right)
+    \; , \; s = n\_snap + 1
+
+*step* is evaluated
+:math:`r N - \left( \begin{array}{c} s + r \\ r - 1 \end{array} \right)`
+times (not counting the :math:`N` evaluations for the reverse mode
+calculations).
+
+x_0
+***
+This is the initial state :math:`x^0` and has size *n* .
+
+w
+*
+This is the weight vector :math:`w` and has size *n* .
+
+x_N
+***
+The input size and value of *x_N* do not matter.
+Upon return, it has size *n* and is the final state :math:`x^N` .
+
+dw
+**
+The return value *dw* has size *n* and is the derivative
+of :math:`w^\R{T} x^N` with respect to :math:`x^0` .
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/revolve_reverse.cpp
+}
+The file :ref:`revolve_reverse.cpp-name`
+contains an example and test of this routine.
+
+{xrst_end revolve_reverse}
+-------------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file revolve_reverse.hpp
+Reverse mode through many time steps using binomial checkpointing.
+*/
+
+namespace local { namespace revolve {
+/*!
+Binomial checkpointing split point.
+
+\param num
+number of steps from the current stored state to the end
+(must be greater than one).
+
+\param snaps
+number of states that can be stored including the current stored state
+(must be greater than one).
+
+\return
+is the number of steps to advance before storing the next state.
+It is between one and num - 1 and minimizes the total number of steps
+for reversing num steps; see Griewank and Walther (2000).
+*/
+inline size_t capo(size_t num, size_t snaps)
+{   CPPAD_ASSERT_UNKNOWN( num > 1 && snaps > 1 );
+    //
+    // reps, range
+    // range = (snaps + reps)! / (snaps! reps!) is the maximum number of
+    // steps that can be reversed with at most reps repetitions.
+    size_t reps  = 0;
+    size_t range = 1;
+    while( range < num )
+    {   ++reps;
+        range = range * (reps + snaps) / reps;
+    }
+    //
+    // bino1, ..., bino5
+    size_t bino1 = range * reps / (snaps + reps);
+    size_t bino2 = 1;
+    if( snaps > 1 )
+        bino2 = bino1 * snaps / (snaps + reps - 1);
+    size_t bino3 = 0;
+    if( snaps == 2 )
+        bino3 = 1;
+    else if( snaps > 2 )
+        bino3 = bino2 * (snaps - 1) / (snaps + reps - 2);
+    size_t bino4 = bino2 * (reps - 1) / snaps;
+    size_t bino5 = 0;
+    if( snaps == 3 )
+        bino5 = 1;
+    else if( snaps > 3 )
+        bino5 = bino3 * (snaps - 2) / reps;
+    //
+    // result
+    size_t result;
+    if( num <= bino1 + bino3 )
+        result = bino4;
+    else if( num >= range - bino5 )
+        result = bino1;
+    else
+        result = num - bino2 - bino3;
+    if( result == 0 )
+        result = 1;
+    CPPAD_ASSERT_UNKNOWN( result < num );
+    return result;
+}
+} } // END_LOCAL_REVOLVE_NAMESPACE
+
+// BEGIN_PROTOTYPE
+template <class Base, class BaseVector>
+BaseVector revolve_reverse(
+    ADFun<Base>&       step     ,
+    size_t             n_step   ,
+    size_t             n_snap   ,
+    const BaseVector&  x_0      ,
+    const BaseVector&  w        ,
+    BaseVector&        x_N      )
+// END_PROTOTYPE
+{   //
+    // n
+    size_t n = step.Domain();
+    CPPAD_ASSERT_KNOWN(
+        step.Range() == n,
+        "revolve_reverse: step domain size not equal its range size"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( x_0.size() ) == n && size_t( w.size() ) == n,
+        "revolve_reverse: size of x_0 or w not equal step domain size"
+    );
+    CPPAD_ASSERT_KNOWN(
+        n_step > 0,
+        "revolve_reverse: n_step is zero"
+    );
+    //
+    // snap_index, snap_state
+    // stack of stored states, snap_state[k] is the state with
+    // time index snap_index[k]. The first element is x_0.
+    vector<size_t>     snap_index(1);
+    vector<BaseVector> snap_state(1);
+    snap_index[0] = 0;
+    snap_state[0] = x_0;
+    //
+    // dw
+    // partial of w^T x^N w.r.t. the state with time index end
+    BaseVector dw = w;
+    //
+    // end, x
+    size_t     end = n_step;
+    BaseVector x(n);
+    while( end > 0 )
+    {   //
+        // s, x
+        // start at the most recently stored state
+        size_t top = snap_index.size() - 1;
+        size_t s   = snap_index[top];
+        x          = snap_state[top];
+        CPPAD_ASSERT_UNKNOWN( s < end );
+        //
+        // s, x, snap_index, snap_state
+        // advance to end - 1 storing states at the binomial split points
+        while( s + 1 < end )
+        {   // n_free
+            // number of states that can be stored
+            size_t n_free = n_snap + 1 - snap_index.size();
+            //
+            // m
+            size_t m = end - 1;
+            if( n_free > 0 )
+                m = s + local::revolve::capo(end - s, n_free + 1);
+            //
+            while( s < m )
+            {   x = step.Forward(0, x);
+                ++s;
+            }
+            if( n_free > 0 )
+            {   snap_index.push_back(s);
+                snap_state.push_back(x);
+            }
+        }
+        //
+        // dw
+        // reverse mode for the step from end - 1 to end
+        CPPAD_ASSERT_UNKNOWN( s + 1 == end );
+        if( end == n_step )
+            x_N = step.Forward(0, x);
+        else
+            step.Forward(0, x);
+        dw = step.Reverse(1, dw);
+        --end;
+        //
+        // snap_index, snap_state
+        // the state with time index end is no longer needed
+        top = snap_index.size() - 1;
+        if( snap_index[top] == end && end > 0 )
+        {   snap_index.resize(top);
+            snap_state.resize(top);
+        }
+    }
+    return dw;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_SPARSE_HES_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -116,7 +116,8 @@ If the *i*-th row (*j*-th column) does not appear in *subset* ,
 the *i*-th row (*j*-th column) of *pattern* does not matter
 and need not be computed.
 This argument is not used (and need not satisfy any conditions),
-when :ref:`sparse_hes@work` is non-empty.
+when :ref:`sparse_hes@work` is non-empty or
+*coloring* is :ref:`sparse_hes@coloring@cppad.edge_push` .
 
 subset
 ======
@@ -135,7 +136,8 @@ This field has prototype
 
     ``const std::string&`` *coloring*
 
-This value only matters when work is empty; i.e.,
+Except for ``cppad.edge_push`` ,
+this value only matters when work is empty; i.e.,
 after the *work* constructor or *work* . ``clear`` () .
 
 cppad.symmetric
@@ -172,6 +174,29 @@ The ``colpack.star`` method is deprecated.
 It is the same as the ``colpack.symmetric`` method
 which should be used instead.
 
+cppad.edge_push
+===============
+This method does not use coloring.
+It computes the Hessian using the edge pushing algorithm; i.e.,
+one reverse sweep that propagates the non-zero second order partials
+for each variable to the arguments of the corresponding operator.
+The work is proportional to the number of non-zeros in the
+Hessian of :math:`w^\R{T} F(x)` with respect to the variables that are
+being eliminated, and not the number of colors.
+This can be much faster than coloring when the Hessian requires
+many colors but has few non-zeros per row.
+
+#.  The *pattern* argument is not used by this method.
+#.  If the operation sequence in *f* contains an
+    :ref:`atomic function<atomic-name>` call,
+    a :ref:`VecAD-name` operation, or an :ref:`azmul-name` operation,
+    edge pushing is not supported and ``cppad.symmetric`` is used instead.
+    In this case, when *work* is empty,
+    the sparsity pattern for the Hessian is computed using
+    :ref:`for_hes_sparsity-name` and stored in *work* ;
+    i.e., *pattern* is still not used.
+#.  If edge pushing is supported, *work* is not used.
+
 work
 ****
 This argument has prototype
@@ -205,6 +230,8 @@ mentioned above.
 This is proportional to the total computational work,
 not counting the zero order forward sweep,
 or combining multiple columns and rows into a single sweep.
+If the ``cppad.edge_push`` method is used, *n_sweep* is one
+(for the edge pushing reverse sweep).
 
 Uses Forward
 ************
@@ -222,10 +249,11 @@ Example
 *******
 {xrst_toc_hidden
     example/sparse/sparse_hes.cpp
+    example/sparse/sparse_hes_edge.cpp
 }
-The files :ref:`sparse_hes.cpp-name`
-is an example and test of ``sparse_hes`` .
-It returns ``true`` , if it succeeds, and ``false`` otherwise.
+The files :ref:`sparse_hes.cpp-name` and :ref:`sparse_hes_edge.cpp-name`
+are examples and tests of ``sparse_hes`` .
+They return ``true`` , if they succeed, and ``false`` otherwise.
 
 Subset Hessian
 **************
@@ -309,7 +337,7 @@ where m is number of dependent variables in f.
 \param coloring
 determines which coloring algorithm is used.
 This must be cppad.symmetric, cppad.general, colpack.symmetric,
-or colpack.star.
+colpack.star, or cppad.edge_push.
 
 \param work
 this structure must be empty, or contain the information stored
@@ -359,6 +387,37 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     const SizeVector& subset_row( subset.row() );
     const SizeVector& subset_col( subset.col() );
     //
+    // edge_push
+    bool edge_push = coloring == "cppad.edge_push";
+    if( edge_push && ! local::sweep::edge_push_supported(&play_) )
+    {   // This operation sequence is not supported by edge pushing.
+        // Use cppad.symmetric with a sparsity pattern computed here
+        // for the rows and columns that appear in subset.
+        sparse_rc<SizeVector> hes_pattern;
+        if( color.size() == 0 && subset.nnz() > 0 )
+        {   vector<bool> select_domain(n), select_range( Range() );
+            for(size_t j = 0; j < n; ++j)
+                select_domain[j] = false;
+            for(size_t i = 0; i < Range(); ++i)
+                select_range[i] = true;
+            for(size_t k = 0; k < subset.nnz(); ++k)
+            {   select_domain[ subset_row[k] ] = true;
+                select_domain[ subset_col[k] ] = true;
+            }
+            bool internal_bool = false;
+            for_hes_sparsity(
+                select_domain, select_range, internal_bool, hes_pattern
+            );
+            // The subset must be contained in the pattern. Entries in the
+            // subset that are not in the Hessian pattern are zero.
+            for(size_t k = 0; k < subset.nnz(); ++k)
+            {   hes_pattern.push_back( subset_row[k], subset_col[k] );
+                hes_pattern.push_back( subset_col[k], subset_row[k] );
+            }
+        }
+        return sparse_hes(x, w, subset, hes_pattern, "cppad.symmetric", work);
+    }
+    //
     // point at which we are evaluating the Hessian
     Forward(0, x);
     //
@@ -370,6 +429,41 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     if( K == 0 )
         return 0;
     //
+    // edge pushing method
+    if( edge_push )
+    {   //
+        // W
+        size_t m = dep_taddr_.size();
+        vector<Base> w_base(m);
+        for(size_t i = 0; i < m; ++i)
+            w_base[i] = w[i];
+        vector< std::map<size_t, Base> > W(num_var_tape_);
+        size_t J = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+        local::sweep::edge_push(
+            num_var_tape_,
+            &play_,
+            J,
+            taylor_.data(),
+            cskip_op_.data(),
+            dep_taddr_,
+            w_base,
+            W
+        );
+        //
+        // subset
+        for(size_t k = 0; k < K; ++k)
+        {   size_t i_var = ind_taddr_[ subset_row[k] ];
+            size_t j_var = ind_taddr_[ subset_col[k] ];
+            typename std::map<size_t, Base>::const_iterator itr =
+                W[i_var].find(j_var);
+            if( itr == W[i_var].end() )
+                subset.set(k, Base(0.0) );
+            else
+                subset.set(k, itr->second);
+        }
+        return 1;
+    }
+    //
 # ifndef NDEBUG
     if( color.size() != 0 )
     {   CPPAD_ASSERT_KNOWN(
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_SUBGRAPH_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin subgraph_reverse}
@@ -404,17 +404,25 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
     local::play::const_subgraph_iterator<Addr> subgraph_itr =
         play_.end_subgraph(random_itr, &subgraph);
     //
+    local::sweep::profile* profile = nullptr;
+    if( sweep_profile_on_ )
+        profile = &sweep_profile_;
+    size_t taylor_stride = 0;
+    size_t n_dir         = 1;
     local::sweep::reverse(
         num_var_tape_,
         &play_,
         cap_order_taylor_,
         taylor_.data(),
+        taylor_stride,
         q,
+        n_dir,
         subgraph_partial_.data(),
         cskip_op_.data(),
         load_op2var_,
         subgraph_itr,
-        not_used_rec_base
+        not_used_rec_base,
+        profile
     );
 
     // number of non-zero in return value
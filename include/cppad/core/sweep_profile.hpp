@@ -0,0 +1,218 @@
+# ifndef CPPAD_CORE_SWEEP_PROFILE_HPP
+# define CPPAD_CORE_SWEEP_PROFILE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin sweep_profile}
+
+Count and Time the Operators in Forward and Reverse Sweeps
+##########################################################
+
+Syntax
+******
+| *f* . ``sweep_profile`` ( *on* )
+| *report* = *f* . ``sweep_profile`` ()
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+It is not always clear which operators dominate the time for a
+forward or reverse mode calculation.
+If profiling is on, the
+:ref:`zero order forward<forward_zero-name>` ,
+:ref:`any order forward<forward_order-name>` ,
+:ref:`reverse<reverse_any-name>` and
+:ref:`subgraph reverse<subgraph_reverse-name>` sweeps for *f*
+count and time each operator.
+Calls to atomic functions are counted and timed separately for each
+atomic function.
+This information can be used to decide what to optimize,
+or which part of a function to replace by an atomic function.
+
+f
+*
+This is the ``ADFun`` object that the profile is for.
+
+on
+**
+If *on* is true, profiling is turned on and all the counts and times
+are set to zero.
+If *on* is false, profiling is turned off and the counts and times
+are not changed.
+Profiling is off when *f* is
+:ref:`constructed<fun_construct-name>` from an operation sequence.
+The profiling state, counts, and times are copied by the ``ADFun``
+:ref:`assignment<fun_construct@Assignment Operator>` operator.
+
+Overhead
+********
+When profiling is on, each operator is timed by reading a clock before
+and after it is evaluated.
+This time can be significant for simple operators,
+so the times are mainly useful for comparing operators to each other.
+When profiling is off, the overhead is one pointer comparison
+per operator.
+
+report
+******
+Each element of *report* is a ``sweep_profile_record``
+which is defined by
+{xrst_literal
+    include/cppad/core/ad_fun.hpp
+    // BEGIN_SWEEP_PROFILE_RECORD
+    // END_SWEEP_PROFILE_RECORD
+}
+There is one element for each operator, and each atomic function,
+that has a non-zero count for one of the sweeps.
+The elements are sorted so that the *seconds* field is non-increasing.
+
+sweep
+=====
+is one of the following:
+``forward_0`` (zero order forward),
+``forward_any`` (forward for orders greater than zero), or
+``reverse`` (reverse mode and subgraph reverse mode).
+
+name
+====
+If *atomic* is false, this is the name of the operator
+(the same name that is used when tracing a sweep).
+Otherwise, it is the name of the atomic function.
+
+atomic
+======
+is true (false) if this element is for an atomic function (an operator).
+
+count
+=====
+is the number of times the operator (atomic function)
+was executed during the specified sweep.
+Operators that are skipped because of
+:ref:`conditional expressions<CondExp-name>` are not counted.
+
+seconds
+=======
+is the total time, in seconds, for all the executions of the operator
+(atomic function) during the specified sweep.
+
+atomic_parallel
+***************
+If :ref:`atomic_parallel-name` is not null,
+zero order forward mode evaluates the atomic functions in batches.
+The time for a batch is then included in the time for the operator
+that first uses one of its results, instead of the atomic functions.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/sweep_profile.cpp
+}
+The file :ref:`sweep_profile.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end sweep_profile}
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file sweep_profile.hpp
+Turn sweep profiling on and off and get the corresponding report.
+*/
+
+/*!
+Turn sweep profiling on or off.
+
+\param on
+If true, profiling is turned on and the counts and times are set to zero.
+Otherwise, profiling is turned off and the counts and times are not changed.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::sweep_profile(bool on)
+// END_PROTOTYPE
+{   if( on )
+        sweep_profile_.clear();
+    sweep_profile_on_ = on;
+}
+
+/*!
+Get the report for the current sweep profile.
+
+\return
+is a vector with one element for each operator, and each atomic function,
+that has a non-zero count for one of the sweeps.
+It is sorted so that the seconds field is non-increasing.
+*/
+template <class Base, class RecBase>
+vector<sweep_profile_record> ADFun<Base,RecBase>::sweep_profile(void) const
+{   typedef local::sweep::profile profile;
+    //
+    // sweep_name
+    const char* sweep_name[] = { "forward_0", "forward_any", "reverse" };
+    CPPAD_ASSERT_UNKNOWN(
+        sizeof(sweep_name) / sizeof(sweep_name[0]) ==
+        size_t(profile::number_sweep_enum)
+    );
+    //
+    // report
+    vector<sweep_profile_record> report;
+    sweep_profile_record         record;
+    for(size_t i_sweep = 0; i_sweep < profile::number_sweep_enum; ++i_sweep)
+    {   profile::sweep_enum sweep = profile::sweep_enum(i_sweep);
+        record.sweep = sweep_name[i_sweep];
+        //
+        // operators
+        record.atomic = false;
+        for(size_t i_op = 0; i_op < size_t(local::NumberOp); ++i_op)
+        {   local::op_code_var op = local::op_code_var(i_op);
+            record.count = sweep_profile_.op_count(sweep, op);
+            if( record.count > 0 )
+            {   record.name    = local::OpName(op);
+                record.seconds = sweep_profile_.op_seconds(sweep, op);
+                report.push_back(record);
+            }
+        }
+        //
+        // atomic functions
+        record.atomic = true;
+        for(size_t atom_index = 0;
+            atom_index < sweep_profile_.n_atom(sweep); ++atom_index)
+        {   record.count = sweep_profile_.atom_count(sweep, atom_index);
+            if( record.count > 0 )
+            {   bool         set_null = false;
+                size_t       type     = 0;       // set to avoid warning
+                void*        v_ptr    = nullptr; // set to avoid warning
+                local::atomic_index<RecBase>(
+                    set_null, atom_index, type, &record.name, v_ptr
+                );
+                record.seconds = sweep_profile_.atom_seconds(sweep, atom_index);
+                report.push_back(record);
+            }
+        }
+    }
+    //
+    // sort report so seconds is non-increasing
+    size_t n_report = report.size();
+    vector<double> key(n_report);
+    for(size_t i = 0; i < n_report; ++i)
+        key[i] = - report[i].seconds;
+    vector<size_t> ind(n_report);
+    index_sort(key, ind);
+    vector<sweep_profile_record> result(n_report);
+    for(size_t i = 0; i < n_report; ++i)
+        result[i] = report[ ind[i] ];
+    //
+    return result;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_TAPE_LINK_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/define.hpp>
@@ -72,6 +72,56 @@ local::ADTape<Base>** AD<Base>::tape_handle(size_t thread)
     return tape_table + thread;
 }
 
+/*!
+Thread number cached by tape_ptr(void) for the current system thread.
+
+\tparam Base
+is the base type for this AD<Base> class.
+
+\return
+is a reference to the thread number that was cached by the previous call to
+tape_ptr(void) or tape_manage by this system thread.
+*/
+template <class Base>
+size_t& AD<Base>::tape_cache_thread(void)
+{   static thread_local size_t cache_thread = 0;
+    return cache_thread;
+}
+
+/*!
+Tape identifier cached by tape_ptr(void) for the current system thread.
+
+\tparam Base
+is the base type for this AD<Base> class.
+
+\return
+is a reference to the tape identifier for tape_cache_thread() when it was
+cached. The value zero is never cached and is used to indicate
+that the cache is not valid.
+*/
+template <class Base>
+tape_id_t& AD<Base>::tape_cache_id(void)
+{   static thread_local tape_id_t cache_id = 0;
+    return cache_id;
+}
+
+/*!
+Number of calls to parallel_setup when the tape_ptr(void) cache was set
+for the current system thread.
+
+\tparam Base
+is the base type for this AD<Base> class.
+
+\return
+is a reference to the value of local::parallel_setup_count() when
+tape_cache_thread() and tape_cache_id() were cached.
+*/
+template <class Base>
+size_t& AD<Base>::tape_cache_setup(void)
+{   static thread_local size_t cache_setup = 0;
+    return cache_setup;
+}
+
 /*!
 Pointer for the tape for this AD<Base> class and the current thread.
 
@@ -87,10 +137,41 @@ is a pointer to the tape that is currently recording AD<Base> operations
 for the current thread.
 If this value is nullptr, there is no tape currently
 recording AD<Base> operations for this thread.
+
+\par Cache
+This routine is called for every AD<Base> operation during a recording.
+Calling thread_alloc::thread_num() may be expensive because it calls the
+user's thread_num function. For this reason, the thread number and
+the corresponding tape identifier are cached for each system thread; see
+tape_cache_thread and tape_cache_id.
+The cache is valid as long as thread_alloc::parallel_setup has not been
+called since the cache was set, and the tape identifier for the cached
+thread number has not changed; i.e., a tape for that thread number
+has not been deleted. The cache is also set by tape_manage.
+The parallel_setup check is necessary because a system thread may have a
+different thread number after parallel_setup is called.
+Between calls to parallel_setup, the thread number for a system thread
+must not change while it is recording.
 */
 template <class Base>
 local::ADTape<Base>* AD<Base>::tape_ptr(void)
-{   size_t thread = thread_alloc::thread_num();
+{   size_t&    cache_thread = tape_cache_thread();
+    tape_id_t& cache_id     = tape_cache_id();
+    size_t&    cache_setup  = tape_cache_setup();
+    size_t     setup        = local::parallel_setup_count();
+    //
+    // check if the cache is valid
+    if( cache_id != 0 && cache_setup == setup )
+    {   if( *tape_id_ptr(cache_thread) == cache_id )
+            return *tape_handle(cache_thread);
+    }
+    //
+    // set the cache
+    size_t thread = thread_alloc::thread_num();
+    cache_thread  = thread;
+    cache_id      = *tape_id_ptr(thread);
+    cache_setup   = setup;
+    //
     return *tape_handle(thread);
 }
 
@@ -223,6 +304,11 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         *tape_id_p  += CPPAD_MAX_NUM_THREADS;
     }
     // -----------------------------------------------------------------------
+    // cache used by tape_ptr(void) for this system thread
+    tape_cache_thread() = thread;
+    tape_cache_id()     = *tape_id_p;
+    tape_cache_setup()  = local::parallel_setup_count();
+    //
     return *tape_h;
 }
 
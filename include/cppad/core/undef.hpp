@@ -2,7 +2,7 @@
 # define CPPAD_CORE_UNDEF_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -49,7 +49,9 @@ that are used by the CppAD examples and tests.
 # undef CPPAD_HAS_EIGEN
 # undef CPPAD_HAS_GETTIMEOFDAY
 # undef CPPAD_HAS_IPOPT
+# undef CPPAD_HAS_MADVISE_HUGEPAGE
 # undef CPPAD_HAS_MKSTEMP
+# undef CPPAD_HAS_SYSCONF_PAGESIZE
 # undef CPPAD_HAS_TMPNAM_S
 # undef CPPAD_INLINE_FRIEND_TEMPLATE_FUNCTION
 # undef CPPAD_IS_SAME_TAPE_ADDR_TYPE_SIZE_T
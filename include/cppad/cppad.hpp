@@ -2,7 +2,7 @@
 # define CPPAD_CPPAD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*!
 \file cppad.hpp
@@ -62,6 +62,8 @@
 # include <cppad/core/lu_ratio.hpp>
 # include <cppad/core/bender_quad.hpp>
 # include <cppad/core/opt_val_hes.hpp>
+# include <cppad/core/revolve_reverse.hpp>
+# include <cppad/core/branch_cache.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/local/graph/json_lexer.hpp>
 # if CPPAD_HAS_IPOPT
@@ -2,7 +2,7 @@
 # define CPPAD_EXAMPLE_ATOMIC_FOUR_MAT_MUL_BASE_MAT_MUL_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four_mat_mul_base_mat_mul.hpp}
@@ -10,6 +10,14 @@
 Atomic Multiply Base Matrices: Example Implementation
 #####################################################
 
+Loop Order
+**********
+The inner loop is over the columns of the result,
+so that it accesses consecutive elements of the result and
+the right matrix (and can be vectorized by the compiler).
+The outer loops are blocked so that a block of the right matrix
+is used for all the rows of the left matrix while it is in cache.
+
 Source
 ******
 {xrst_literal
@@ -20,6 +28,7 @@ Source
 {xrst_end atomic_four_mat_mul_base_mat_mul.hpp}
 */
 // BEGIN C++
+# include <algorithm>
 # include <cppad/example/atomic_four/mat_mul/mat_mul.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -46,19 +55,36 @@ void atomic_mat_mul<Base>::base_mat_mul(
     // offset
     size_t offset = n_left * n_middle;
     //
-    // y
+    // x_ptr, y_ptr
+    const Base* x_ptr = x.data();
+    Base*       y_ptr = y.data();
+    //
+    // y = 0
+    for(size_t ij = 0; ij < n_left * n_right; ++ij)
+        y_ptr[ij] = Base(0);
+    //
     // y[ i * n_right + j] = sum_k
     //      x[i * n_middle + k] * x[ offset + k * n_right + j]
-    // type_y
-    for(size_t i = 0; i < n_left; ++i)
-    {   for(size_t j = 0; j < n_right; ++j)
-        {   Base sum_ij = Base(0);
-            for(size_t k = 0; k < n_middle; ++k)
-            {   Base left_ik  = x[i * n_middle + k];
-                Base right_kj = x[offset + k * n_right + j];
-                sum_ij       += left_ik * right_kj;
+    //
+    // The loops are ordered so that the inner loop is over j and accesses
+    // consecutive elements of both y and the right matrix. The k and j
+    // loops are blocked so that a block of the right matrix stays in cache
+    // while it is used for all the rows of the left matrix.
+    // The order of the sum over k is the same as without blocking.
+    size_t block = 64;
+    for(size_t k_start = 0; k_start < n_middle; k_start += block)
+    {   size_t k_end = std::min(k_start + block, n_middle);
+        for(size_t j_start = 0; j_start < n_right; j_start += block)
+        {   size_t j_end = std::min(j_start + block, n_right);
+            for(size_t i = 0; i < n_left; ++i)
+            {   Base* y_i = y_ptr + i * n_right;
+                for(size_t k = k_start; k < k_end; ++k)
+                {   Base        left_ik = x_ptr[i * n_middle + k];
+                    const Base* right_k = x_ptr + offset + k * n_right;
+                    for(size_t j = j_start; j < j_end; ++j)
+                        y_i[j] += left_ik * right_k[j];
+                }
             }
-            y[i * n_right + j] = sum_ij;
         }
     }
     return;
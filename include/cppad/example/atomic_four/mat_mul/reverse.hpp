@@ -2,7 +2,7 @@
 # define CPPAD_EXAMPLE_ATOMIC_FOUR_MAT_MUL_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four_mat_mul_reverse.hpp}
@@ -66,11 +66,13 @@ bool atomic_mat_mul<Base>::reverse(
     // offset
     size_t x_offset = n_left * n_middle;
     //
-    // u, v, u_offset
-    // note that resize only re-allocates when capacity is not large enough
-    CppAD::vector<Base> u;
-    CppAD::vector<Base> v;
-    size_t u_offset;
+    // a, b, c_bar, b_bar
+    // A^ell, B^{k-ell}, \bar{C}^k, and the increment to \bar{B}^{k-ell}
+    // stored in row major order without the Taylor coefficient stride q.
+    CppAD::vector<Base> a(n_left * n_middle);
+    CppAD::vector<Base> b(n_middle * n_right);
+    CppAD::vector<Base> c_bar(n_left * n_right);
+    CppAD::vector<Base> b_bar(n_middle * n_right);
     //
     // partial_x
     for(size_t i = 0; i < partial_x.size(); ++i)
@@ -81,57 +83,53 @@ bool atomic_mat_mul<Base>::reverse(
     while(k > 0)
     {   --k;
         //
+        // c_bar = \bar{C}^k
+        for(size_t i = 0; i < n_left * n_right; ++i)
+            c_bar[i] = partial_y[ i * q + k ];
+        //
         // for ell = 0, ..., k :
         //    bar{A}^ell      += bar{C}^k [ B^{k-ell} ]^T
         //    bar{B}^{k-ell}  += [ A^ell ]^T \bar{C}^k
-        for(size_t ell = 0; ell < q; ++ell)
+        for(size_t ell = 0; ell <= k; ++ell)
         {   //
-            // u = [ \bar{C}^k, B^{k-ell}^T ]
-            u.resize(0);
-            u.resize( n_left * n_right + n_right * n_middle );
-            u_offset = n_left * n_right;
-            for(size_t i = 0; i < n_left * n_right; ++i)
-                u[i] = partial_y[ i * q + k ];
-            for(size_t i = 0; i < n_middle; ++i)
-            {   for(size_t j = 0; j < n_right; ++j)
-                {   size_t ij = i * n_right + j;
-                    size_t ji = j * n_middle + i;
-                    u[u_offset + ji] =
-                        taylor_x[(x_offset + ij) * q + (k - ell) ];
-                }
-            }
-            //
-            // v = \bar{C} * [ B^{k-ell} ]^T
-            v.resize(0);
-            v.resize( n_left * n_middle );
-            base_mat_mul(n_left, n_right, n_middle, u, v);
-            //
-            // \bar{A}^ell += v
+            // a = A^ell, b = B^{k-ell}
             for(size_t i = 0; i < n_left * n_middle; ++i)
-                partial_x[i * q + ell] += v[i];
+                a[i] = taylor_x[ i * q + ell ];
+            for(size_t i = 0; i < n_middle * n_right; ++i)
+                b[i] = taylor_x[ (x_offset + i) * q + (k - ell) ];
             //
-            // u = [ A^ell^T , \bar{C}^k ]
-            u.resize(0);
-            u.resize( n_middle * n_left + n_left * n_right );
-            u_offset = n_middle * n_left;
+            // \bar{A}^ell += \bar{C}^k [ B^{k-ell} ]^T
+            // The inner loop is over consecutive elements of a row of
+            // \bar{C}^k and a row of B^{k-ell}.
             for(size_t i = 0; i < n_left; ++i)
-            {   for(size_t j = 0; j < n_middle; ++j)
-                {   size_t ij = i * n_middle + j;
-                    size_t ji = j * n_left + i;
-                    u[ji] = taylor_x[ij * q + ell];
+            {   const Base* c_bar_i = c_bar.data() + i * n_right;
+                for(size_t ell_m = 0; ell_m < n_middle; ++ell_m)
+                {   const Base* b_m = b.data() + ell_m * n_right;
+                    Base sum = Base(0);
+                    for(size_t j = 0; j < n_right; ++j)
+                        sum += c_bar_i[j] * b_m[j];
+                    partial_x[ (i * n_middle + ell_m) * q + ell ] += sum;
                 }
             }
-            for(size_t i = 0; i < n_left * n_right; ++i)
-                u[u_offset + i] = partial_y[ i * q + k ];
             //
-            // v = [ A^ell ]^T * \bar{C}^k
-            v.resize(0);
-            v.resize( n_middle * n_right );
-            base_mat_mul(n_middle, n_left, n_right, u, v);
+            // b_bar = [ A^ell ]^T \bar{C}^k
+            // The inner loop is over consecutive elements of a row of
+            // b_bar and a row of \bar{C}^k.
+            for(size_t i = 0; i < n_middle * n_right; ++i)
+                b_bar[i] = Base(0);
+            for(size_t i = 0; i < n_left; ++i)
+            {   const Base* c_bar_i = c_bar.data() + i * n_right;
+                for(size_t ell_m = 0; ell_m < n_middle; ++ell_m)
+                {   Base  a_im    = a[i * n_middle + ell_m];
+                    Base* b_bar_m = b_bar.data() + ell_m * n_right;
+                    for(size_t j = 0; j < n_right; ++j)
+                        b_bar_m[j] += a_im * c_bar_i[j];
+                }
+            }
             //
-            // \bar{B}^{k-\ell} += v
+            // \bar{B}^{k-\ell} += b_bar
             for(size_t i = 0; i < n_middle * n_right; ++i)
-                partial_x[ (x_offset + i) * q + (k - ell) ] += v[i];
+                partial_x[ (x_offset + i) * q + (k - ell) ] += b_bar[i];
         }
     }
     return true;
@@ -188,7 +186,7 @@ bool atomic_mat_mul<Base>::reverse(
         // for ell = 0, ..., k :
         //    bar{A}^ell      += bar{C}^k [ B^{k-ell} ]^T
         //    bar{B}^{k-ell}  += [ A^ell ]^T \bar{C}^k
-        for(size_t ell = 0; ell < q; ++ell)
+        for(size_t ell = 0; ell <= k; ++ell)
         {   //
             // u = [ \bar{C}^k, B^{k-ell}^T ]
             u.resize(0);
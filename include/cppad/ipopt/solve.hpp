@@ -2,7 +2,7 @@
 # define CPPAD_IPOPT_SOLVE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin ipopt_solve}
@@ -110,18 +110,28 @@ these calculations.
 The default for *value* is ``false`` .
 If sparse is true, retape must be false.
 
-It is unclear if :ref:`sparse_jacobian-name` would be faster user
+It is unclear if :ref:`sparse_jac-name` would be faster using
 forward or reverse mode so you are able to choose the direction.
 If
 
     *value* == ``true &&`` *direction* == ``forward``
 
-the Jacobians will be calculated using ``SparseJacobianForward`` .
+the Jacobians will be calculated using ``sparse_jac_for`` .
 If
 
     *value* == ``true &&`` *direction* == ``reverse``
 
-the Jacobians will be calculated using ``SparseJacobianReverse`` .
+the Jacobians will be calculated using ``sparse_jac_rev`` .
+If
+
+    *value* == ``true &&`` *direction* == ``subgraph``
+
+the Jacobians will be calculated using :ref:`subgraph_jac_rev-name` .
+In all of these cases, the Hessians are calculated using
+:ref:`sparse_hes-name` .
+The sparsity patterns, and the corresponding coloring
+and other work information, are computed once and reused for each
+Jacobian and Hessian evaluation.
 
 String
 ======
@@ -491,6 +501,7 @@ void solve(
     bool retape          = false;
     bool sparse_forward  = false;
     bool sparse_reverse  = false;
+    bool sparse_subgraph = false;
     while( begin_1 < options.size() )
     {   // split this line into tokens
         while( options[begin_1] == ' ')
@@ -551,16 +562,21 @@ void solve(
                 "ipopt::solve: Sparse value is not true or false"
             );
             CPPAD_ASSERT_KNOWN(
-                (tok_3 == "forward") || (tok_3 == "reverse") ,
-                "ipopt::solve: Sparse direction is not forward or reverse"
+                (tok_3 == "forward") ||
+                (tok_3 == "reverse") ||
+                (tok_3 == "subgraph") ,
+                "ipopt::solve: Sparse direction is not "
+                "forward, reverse, or subgraph"
             );
             if( tok_2 == "false" )
-            {   sparse_forward = false;
-                sparse_reverse = false;
+            {   sparse_forward  = false;
+                sparse_reverse  = false;
+                sparse_subgraph = false;
             }
             else
-            {   sparse_forward = tok_3 == "forward";
-                sparse_reverse = tok_3 == "reverse";
+            {   sparse_forward  = tok_3 == "forward";
+                sparse_reverse  = tok_3 == "reverse";
+                sparse_subgraph = tok_3 == "subgraph";
             }
         }
         else if ( tok_1 == "String" )
@@ -591,7 +607,7 @@ void solve(
         begin_1++;
     }
     CPPAD_ASSERT_KNOWN(
-        ! ( retape & (sparse_forward | sparse_reverse) ) ,
+        ! ( retape & (sparse_forward | sparse_reverse | sparse_subgraph) ) ,
         "ipopt::solve: retape and sparse both true is not supported."
     );
 
@@ -620,6 +636,7 @@ void solve(
         retape,
         sparse_forward,
         sparse_reverse,
+        sparse_subgraph,
         solution
     );
 
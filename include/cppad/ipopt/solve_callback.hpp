@@ -2,7 +2,7 @@
 # define CPPAD_IPOPT_SOLVE_CALLBACK_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/cppad.hpp>
@@ -75,6 +75,9 @@ private:
     /// Should sparse methods be used to compute Jacobians and Hessians
     /// with reverse mode used for Jacobian.
     bool                            sparse_reverse_;
+    /// Should sparse methods be used to compute Jacobians and Hessians
+    /// with reverse mode on subgraphs used for Jacobian.
+    bool                            sparse_subgraph_;
     /// final results are returned to this structure
     solve_result<Dvector>&          solution_;
     // ------------------------------------------------------------------
@@ -88,13 +91,16 @@ private:
     Dvector                         x0_;
     /// value of fg corresponding to previous new_x
     Dvector                         fg0_;
+    /// is one of sparse_forward_, sparse_reverse_, sparse_subgraph_ true
+    bool                            sparse_;
     // ----------------------------------------------------------------------
     // Jacobian information
     // ----------------------------------------------------------------------
-    /// Sparsity pattern for Jacobian of [f(x), g(x) ].
+    /// Sparsity pattern for Jacobian of [f(x), g(x) ] with the rows
+    /// corresponding to f(x) left out (so they do not affect the coloring).
     /// If sparse is true, this pattern set by constructor and does not change.
-    /// Otherwise this vector has size zero.
-    CppAD::vectorBool               pattern_jac_;
+    /// Otherwise this pattern has no possibly non-zero entries.
+    CppAD::sparse_rc< CppAD::vector<size_t> > pattern_jac_;
     /// Row indices of [f(x), g(x)] for Jacobian of g(x) in row order.
     /// (Set by constructor and not changed.)
     CppAD::vector<size_t>           row_jac_;
@@ -104,24 +110,30 @@ private:
     /// col_order_jac_ sorts row_jac_ and col_jac_ in column order.
     /// (Set by constructor and not changed.)
     CppAD::vector<size_t>           col_order_jac_;
-    /// Work vector used by SparseJacobian, stored here to avoid recalculation.
-    CppAD::sparse_jacobian_work     work_jac_;
+    /// If sparse is true, entries in the Jacobian of g(x) in same
+    /// order as row_jac_. (Sparsity set by constructor and not changed.)
+    CppAD::sparse_rcv< CppAD::vector<size_t>, Dvector > subset_jac_;
+    /// Work vector used by sparse_jac, stored here to avoid recalculation.
+    CppAD::sparse_jac_work          work_jac_;
     // ----------------------------------------------------------------------
     // Hessian information
     // ----------------------------------------------------------------------
     /// Sparsity pattern for Hessian of Lagragian
     /// \f[ L(x) = \sigma \sum_i f_i (x) + \sum_i \lambda_i  g_i (x) \f]
     /// If sparse is true, this pattern set by constructor and does not change.
-    /// Otherwise this vector has size zero.
-    CppAD::vectorBool               pattern_hes_;
+    /// Otherwise this pattern has no possibly non-zero entries.
+    CppAD::sparse_rc< CppAD::vector<size_t> > pattern_hes_;
     /// Row indices of Hessian lower left triangle in row order.
     /// (Set by constructor and not changed.)
     CppAD::vector<size_t>           row_hes_;
     /// Column indices of Hessian left triangle in same order as row_hes_.
     /// (Set by constructor and not changed.)
     CppAD::vector<size_t>           col_hes_;
-    /// Work vector used by SparseJacobian, stored here to avoid recalculation.
-    CppAD::sparse_hessian_work      work_hes_;
+    /// If sparse is true, entries in the Hessian of the Lagragian in same
+    /// order as row_hes_. (Sparsity set by constructor and not changed.)
+    CppAD::sparse_rcv< CppAD::vector<size_t>, Dvector > subset_hes_;
+    /// Work vector used by sparse_hes, stored here to avoid recalculation.
+    CppAD::sparse_hes_work          work_hes_;
     // ------------------------------------------------------------------
     // Private member functions
     // ------------------------------------------------------------------
@@ -206,7 +218,12 @@ public:
     \param sparse_reverse
     should sparse matrix computations be used for Jacobians and Hessians
     with reverse mode for Jacobian.
-    (sparse_forward and sparse_reverse cannot both be true).
+
+    \param sparse_subgraph
+    should sparse matrix computations be used for Jacobians and Hessians
+    with reverse mode on subgraphs for Jacobian.
+    (At most one of sparse_forward, sparse_reverse, and sparse_subgraph
+    can be true).
 
     \param solution
     object where final results are stored.
@@ -224,6 +241,7 @@ public:
         bool                   retape          ,
         bool                   sparse_forward  ,
         bool                   sparse_reverse  ,
+        bool                   sparse_subgraph ,
         solve_result<Dvector>& solution ) :
     nf_ ( nf ),
     nx_ ( nx ),
@@ -237,8 +255,13 @@ public:
     retape_ ( retape ),
     sparse_forward_ ( sparse_forward ),
     sparse_reverse_ ( sparse_reverse ),
-    solution_ ( solution )
-    {   CPPAD_ASSERT_UNKNOWN( ! ( sparse_forward_ & sparse_reverse_ ) );
+    sparse_subgraph_ ( sparse_subgraph ),
+    solution_ ( solution ),
+    sparse_ ( sparse_forward | sparse_reverse | sparse_subgraph )
+    {   CPPAD_ASSERT_UNKNOWN(
+            size_t(sparse_forward) + size_t(sparse_reverse)
+            + size_t(sparse_subgraph) <= 1
+        );
 
         size_t i, j;
         size_t nfg = nf_ + ng_;
@@ -262,151 +285,86 @@ public:
             // optimize because we will make repeated use of this tape
             adfun_.optimize();
         }
-        if( sparse_forward_ | sparse_reverse_ )
+        if( sparse_ )
         {   CPPAD_ASSERT_UNKNOWN( ! retape );
             size_t m = nf_ + ng_;
+            typedef CppAD::vector<size_t>       SizeVector;
+            typedef CppAD::sparse_rc<SizeVector> sparsity;
+            //
+            // use sets (instead of bits) for sparsity patterns because
+            // these problems usually have many variables and are sparse
+            bool internal_bool = false;
+            bool dependency    = false;
+            bool transpose     = false;
             //
             // -----------------------------------------------------------
             // Jacobian
-            pattern_jac_.resize( m * nx_ );
+            sparsity pattern_fg;
             if( nx_ <= m )
             {   // use forward mode to compute sparsity
-
-                // number of bits that are packed into one unit in vectorBool
-                size_t n_column = vectorBool::bit_per_unit();
-
-                // sparsity patterns for current columns
-                vectorBool r(nx_ * n_column), s(m * n_column);
-
-                // compute the sparsity pattern n_column columns at a time
-                size_t n_loop = (nx_ - 1) / n_column + 1;
-                for(size_t i_loop = 0; i_loop < n_loop; i_loop++)
-                {   // starting column index for this iteration
-                    size_t i_column = i_loop * n_column;
-
-                    // pattern that picks out the appropriate columns
-                    for(i = 0; i < nx_; i++)
-                    {   for(j = 0; j < n_column; j++)
-                            r[i * n_column + j] = (i == i_column + j);
-                    }
-                    s = adfun_.ForSparseJac(n_column, r);
-
-                    // fill in the corresponding columns of total_sparsity
-                    for(i = 0; i < m; i++)
-                    {   for(j = 0; j < n_column; j++)
-                        {   if( i_column + j < nx_ )
-                                pattern_jac_[i * nx_ + i_column + j] =
-                                    s[i * n_column + j];
-                        }
-                    }
-                }
+                sparsity identity(nx_, nx_, nx_);
+                for(j = 0; j < nx_; j++)
+                    identity.set(j, j, j);
+                adfun_.for_jac_sparsity(
+                    identity, transpose, dependency, internal_bool, pattern_fg
+                );
             }
             else
             {   // use reverse mode to compute sparsity
-
-                // number of bits that are packed into one unit in vectorBool
-                size_t n_row = vectorBool::bit_per_unit();
-
-                // sparsity patterns for current rows
-                vectorBool r(n_row * m), s(n_row * nx_);
-
-                // compute the sparsity pattern n_row row at a time
-                size_t n_loop = (m - 1) / n_row + 1;
-                for(size_t i_loop = 0; i_loop < n_loop; i_loop++)
-                {   // starting row index for this iteration
-                    size_t i_row = i_loop * n_row;
-
-                    // pattern that picks out the appropriate rows
-                    for(i = 0; i < n_row; i++)
-                    {   for(j = 0; j < m; j++)
-                            r[i * m + j] = (i_row + i ==  j);
-                    }
-                    s = adfun_.RevSparseJac(n_row, r);
-
-                    // fill in corresponding rows of total sparsity
-                    for(i = 0; i < n_row; i++)
-                    {   for(j = 0; j < nx_; j++)
-                            if( i_row + i < m )
-                                pattern_jac_[ (i_row + i) * nx_ + j ] =
-                                    s[ i  * nx_ + j];
-                    }
-                }
-            }
-            /*
-            {   // use reverse mode to compute sparsity
-                CppAD::vectorBool s(m * m);
+                sparsity identity(m, m, m);
                 for(i = 0; i < m; i++)
-                {   for(j = 0; j < m; j++)
-                        s[i * m + j] = (i == j);
-                }
-                pattern_jac_ = adfun_.RevSparseJac(m, s);
+                    identity.set(i, i, i);
+                adfun_.rev_jac_sparsity(
+                    identity, transpose, dependency, internal_bool, pattern_fg
+                );
             }
-            */
             // Set row and column indices in Jacoian of [f(x), g(x)]
             // for Jacobian of g(x). These indices are in row major order.
-            for(i = nf_; i < nfg; i++)
-            {   for(j = 0; j < nx_; j++)
-                {   if( pattern_jac_[ i * nx_ + j ] )
-                    {   row_jac_.push_back(i);
-                        col_jac_.push_back(j);
-                    }
+            SizeVector row_major = pattern_fg.row_major();
+            for(size_t ell = 0; ell < pattern_fg.nnz(); ell++)
+            {   size_t k = row_major[ell];
+                i        = pattern_fg.row()[k];
+                j        = pattern_fg.col()[k];
+                if( i >= nf_ )
+                {   row_jac_.push_back(i);
+                    col_jac_.push_back(j);
                 }
             }
-            // Set row and column indices in Jacoian of [f(x), g(x)]
-            // for Jacobian of g(x). These indices are in row major order.
+            // pattern_jac_, subset_jac_
+            size_t nk = row_jac_.size();
+            pattern_jac_.resize(m, nx_, nk);
+            for(size_t k = 0; k < nk; k++)
+                pattern_jac_.set(k, row_jac_[k], col_jac_[k]);
+            subset_jac_ = CppAD::sparse_rcv<SizeVector, Dvector>(pattern_jac_);
             // -----------------------------------------------------------
             // Hessian
-            pattern_hes_.resize(nx_ * nx_);
-
-            // number of bits that are packed into one unit in vectorBool
-            size_t n_column = vectorBool::bit_per_unit();
-
-            // sparsity patterns for current columns
-            vectorBool r(nx_ * n_column), h(nx_ * n_column);
-
-            // sparsity pattern for range space of function
-            vectorBool s(m);
+            CppAD::vector<bool> select_domain(nx_), select_range(m);
+            for(j = 0; j < nx_; j++)
+                select_domain[j] = true;
             for(i = 0; i < m; i++)
-                s[i] = true;
-
-            // compute the sparsity pattern n_column columns at a time
-            size_t n_loop = (nx_ - 1) / n_column + 1;
-            for(size_t i_loop = 0; i_loop < n_loop; i_loop++)
-            {   // starting column index for this iteration
-                size_t i_column = i_loop * n_column;
-
-                // pattern that picks out the appropriate columns
-                for(i = 0; i < nx_; i++)
-                {   for(j = 0; j < n_column; j++)
-                        r[i * n_column + j] = (i == i_column + j);
-                }
-                adfun_.ForSparseJac(n_column, r);
-
-                // sparsity pattern corresponding to paritls w.r.t. (theta, u)
-                // of partial w.r.t. the selected columns
-                bool transpose = true;
-                h = adfun_.RevSparseHes(n_column, s, transpose);
-
-                // fill in the corresponding columns of total_sparsity
-                for(i = 0; i < nx_; i++)
-                {   for(j = 0; j < n_column; j++)
-                    {   if( i_column + j < nx_ )
-                            pattern_hes_[i * nx_ + i_column + j] =
-                                h[i * n_column + j];
-                    }
-                }
-            }
+                select_range[i] = true;
+            adfun_.for_hes_sparsity(
+                select_domain, select_range, internal_bool, pattern_hes_
+            );
+            //
             // Set row and column indices for Lower triangle of Hessian
             // of Lagragian.  These indices are in row major order.
-            for(i = 0; i < nx_; i++)
-            {   for(j = 0; j < nx_; j++)
-                {   if( pattern_hes_[ i * nx_ + j ] )
-                    if( j <= i )
-                    {   row_hes_.push_back(i);
-                        col_hes_.push_back(j);
-                    }
+            row_major = pattern_hes_.row_major();
+            for(size_t ell = 0; ell < pattern_hes_.nnz(); ell++)
+            {   size_t k = row_major[ell];
+                i        = pattern_hes_.row()[k];
+                j        = pattern_hes_.col()[k];
+                if( j <= i )
+                {   row_hes_.push_back(i);
+                    col_hes_.push_back(j);
                 }
             }
+            // subset_hes_
+            nk = row_hes_.size();
+            sparsity lower(nx_, nx_, nk);
+            for(size_t k = 0; k < nk; k++)
+                lower.set(k, row_hes_[k], col_hes_[k]);
+            subset_hes_ = CppAD::sparse_rcv<SizeVector, Dvector>(lower);
         }
         else
         {   // Set row and column indices in Jacoian of [f(x), g(x)]
@@ -464,7 +422,7 @@ public:
         nnz_h_lag = static_cast<Index>(row_hes_.size());
 
 # ifndef NDEBUG
-        if( ! (sparse_forward_ | sparse_reverse_) )
+        if( ! sparse_ )
         {   size_t nnz = static_cast<size_t>(nnz_jac_g);
             CPPAD_ASSERT_UNKNOWN( nnz == ng_ * nx_);
             //
@@ -806,19 +764,23 @@ public:
         if( nk == 0 )
             return true;
         //
-        if( sparse_forward_ )
-        {   Dvector jac(nk);
-            adfun_.SparseJacobianForward(
-                x0_ , pattern_jac_, row_jac_, col_jac_, jac, work_jac_
-            );
-            for(k = 0; k < nk; k++)
-                values[k] = jac[k];
-        }
-        else if( sparse_reverse_ )
-        {   Dvector jac(nk);
-            adfun_.SparseJacobianReverse(
-                x0_ , pattern_jac_, row_jac_, col_jac_, jac, work_jac_
-            );
+        if( sparse_ )
+        {   if( sparse_forward_ )
+            {   size_t group_max = 1;
+                adfun_.sparse_jac_for(group_max,
+                    x0_, subset_jac_, pattern_jac_, "cppad", work_jac_
+                );
+            }
+            else if( sparse_reverse_ )
+            {   adfun_.sparse_jac_rev(
+                    x0_, subset_jac_, pattern_jac_, "cppad", work_jac_
+                );
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( sparse_subgraph_ );
+                adfun_.subgraph_jac_rev(x0_, subset_jac_);
+            }
+            const Dvector& jac( subset_jac_.val() );
             for(k = 0; k < nk; k++)
                 values[k] = jac[k];
         }
@@ -992,11 +954,11 @@ public:
         for(i = 0; i < ng_; i++)
             w[i + nf_] = lambda[i];
         //
-        if( sparse_forward_ | sparse_reverse_ )
-        {   Dvector hes(nk);
-            adfun_.SparseHessian(
-                x0_, w, pattern_hes_, row_hes_, col_hes_, hes, work_hes_
+        if( sparse_ )
+        {   adfun_.sparse_hes(
+                x0_, w, subset_hes_, pattern_hes_, "cppad.symmetric", work_hes_
             );
+            const Dvector& hes( subset_hes_.val() );
             for(k = 0; k < nk; k++)
                 values[k] = hes[k];
         }
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_AD_TAPE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/define.hpp>
 
@@ -135,7 +135,8 @@ public:
         ADBaseVector&   x              ,
         size_t          abort_op_index ,
         bool            record_compare ,
-        ADBaseVector&   dynamic
+        ADBaseVector&   dynamic        ,
+        size_t          reserve
     );
 
 };
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_DECLARE_AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/configure.hpp>
@@ -40,6 +40,7 @@ namespace CppAD {
     typedef CPPAD_TAPE_ID_TYPE   tape_id_t;
 
     // classes
+    class forward_change_work;
     class sparse_hes_work;
     class sparse_jac_work;
     class sparse_jacobian_work;
@@ -50,6 +51,7 @@ namespace CppAD {
     template <class Base> class atomic_three;
     template <class Base> class atomic_four;
     template <class Base> class discrete;
+    template <class Base> class hes_vec_work;
     template <class Base> class VecAD;
     template <class Base> class VecAD_reference;
 
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_INDEPENDENT_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 namespace CppAD { namespace local { //  BEGIN_CPPAD_LOCAL_NAMESPACE
 /*
@@ -28,6 +28,9 @@ of operations). The value zero corresponds to not aborting (will not match).
 
 \param dynamic
 Vector of dynamic parameters.
+
+\param reserve
+number of variable operators to reserve memory for (zero for no hint).
 */
 template <class Base>
 template <class ADVector>
@@ -35,7 +38,8 @@ void ADTape<Base>::Independent(
     ADVector&    x               ,
     size_t       abort_op_index  ,
     bool         record_compare  ,
-    ADVector&    dynamic
+    ADVector&    dynamic         ,
+    size_t       reserve
 ) {
     // check ADVector is Simple Vector class with AD<Base> elements
     CheckSimpleVector< AD<Base>, ADVector>();
@@ -56,6 +60,10 @@ void ADTape<Base>::Independent(
     Rec_.set_abort_op_index(abort_op_index);
     Rec_.set_n_dyn_independent( dynamic.size() );
 
+    // memory for the operation sequence
+    if( reserve > 0 )
+        Rec_.reserve(reserve);
+
     // mark the beginning of the tape and skip the first variable index
     // (zero) because parameters use taddr zero
     CPPAD_ASSERT_NARG_NRES(BeginOp, 1, 1);
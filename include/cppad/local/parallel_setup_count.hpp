@@ -0,0 +1,50 @@
+# ifndef CPPAD_LOCAL_PARALLEL_SETUP_COUNT_HPP
+# define CPPAD_LOCAL_PARALLEL_SETUP_COUNT_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cstddef>
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*
+{xrst_begin parallel_setup_count dev}
+
+Number of Calls to parallel_setup
+#################################
+Count the number of calls to :ref:`ta_parallel_setup-name` .
+This is used to invalidate values that are cached for each system thread
+and depend on the thread number for the system thread;
+e.g., the tape cache in ``AD`` < *Base* >:: ``tape_ptr`` () .
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN PROTOTYPE
+    // END PROTOTYPE
+}
+
+increment
+*********
+If *increment* is true, the count is incremented.
+In this case we must be in sequential execution mode; i.e., not parallel.
+
+count
+*****
+is the number of times this routine has been called with *increment* true.
+
+{xrst_end parallel_setup_count}
+*/
+// BEGIN PROTOTYPE
+// count = CppAD::local::parallel_setup_count( .. )
+inline size_t parallel_setup_count(bool increment = false)
+// END PROTOTYPE
+{   static size_t count = 0;
+    if( increment )
+        ++count;
+    return count;
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
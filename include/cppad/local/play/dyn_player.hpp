@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_DYN_PLAYER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/pod_vector.hpp>
 
@@ -147,6 +147,20 @@ This used to compute :ref:`fun_property@size_op_seq` for an ADFun object.
     // END_SIZE_OP_SEQ
 }
 
+memory_report
+*************
+This appends one element to *report* for each of the vectors in
+*dyn_play* .
+The element type must have a ``std::string`` field *name*
+and a ``size_t`` field *bytes* ; e.g., :ref:`memory_report-name` .
+The *bytes* field is the amount of memory allocated for the vector
+(capacities, not lengths, are used for this computation).
+This is used to compute :ref:`memory_report-name` for an ADFun object.
+{xrst_literal
+    // BEGIN_MEMORY_REPORT
+    // END_MEMORY_REPORT
+}
+
 {xrst_end dyn_player}
 */
 
@@ -441,6 +455,34 @@ public:
             + dyn_par_arg_.size()   * sizeof(addr_t)
         ;
     }
+    //
+    // BEGIN_MEMORY_REPORT
+    // dyn_play.memory_report(report)
+    template <class RecordVector>
+    void memory_report(RecordVector& report) const
+    // END_MEMORY_REPORT
+    {   typename RecordVector::value_type record;
+        //
+        record.name  = "par_all";
+        record.bytes = par_all_.capacity() * sizeof(Base);
+        report.push_back(record);
+        //
+        record.name  = "par_is_dyn";
+        record.bytes = par_is_dyn_.capacity() * sizeof(bool);
+        report.push_back(record);
+        //
+        record.name  = "dyn2par_index";
+        record.bytes = dyn2par_index_.capacity() * sizeof(addr_t);
+        report.push_back(record);
+        //
+        record.name  = "dyn_par_op";
+        record.bytes = dyn_par_op_.capacity() * sizeof(opcode_t);
+        report.push_back(record);
+        //
+        record.name  = "dyn_par_arg";
+        record.bytes = dyn_par_arg_.capacity() * sizeof(addr_t);
+        report.push_back(record);
+    }
 };
 
 } } // END_CPPAD_lOCAL_NAMESPACE
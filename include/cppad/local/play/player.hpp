@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_PLAYER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/addr_enum.hpp>
@@ -10,6 +10,7 @@
 # include <cppad/local/play/subgraph_iterator.hpp>
 # include <cppad/local/play/dyn_player.hpp>
 # include <cppad/local/play/random_setup.hpp>
+# include <cppad/local/play/skip_run.hpp>
 # include <cppad/local/atom_state.hpp>
 # include <cppad/local/is_pod.hpp>
 
@@ -138,6 +139,26 @@ struct random_itr_info_t {
         //
         return result;
     }
+    //
+    // memory
+    // number of bytes currently allocated for this information
+    size_t memory(void) const
+    {   size_t result = 0;
+        //
+        result += short_op2arg.capacity()  * sizeof(unsigned short);
+        result += short_op2var.capacity()  * sizeof(unsigned short);
+        result += short_var2op.capacity()  * sizeof(unsigned short);
+        //
+        result += addr_t_op2arg.capacity() * sizeof(addr_t);
+        result += addr_t_op2var.capacity() * sizeof(addr_t);
+        result += addr_t_var2op.capacity() * sizeof(addr_t);
+        //
+        result += size_t_op2arg.capacity() * sizeof(size_t);
+        result += size_t_op2var.capacity() * sizeof(size_t);
+        result += size_t_var2op.capacity() * sizeof(size_t);
+        //
+        return result;
+    }
 };
 
 template <class Base>
@@ -185,6 +206,10 @@ private:
     // and for using const_subgraph_iterator.
     random_itr_info_t random_itr_info_;
     //
+    // skip_run_
+    // Runs of contiguous operators that a CSkipOp can skip.
+    play::skip_run_t skip_run_;
+    //
 public:
     //
     /// default constructor
@@ -294,6 +319,9 @@ public:
         // random access information
         clear_random();
 
+        // skip_run_
+        skip_run_.set(num_var_, var_op_, var_arg_);
+
         // some checks
         check_inv_op(n_ind);
         check_variable_dag();
@@ -517,6 +545,9 @@ public:
         //
         // random_itr_info_
         random_itr_info_    = play.random_itr_info_;
+        //
+        // skip_run_
+        skip_run_           = play.skip_run_;
     }
     //
     // base2ad
@@ -541,6 +572,9 @@ public:
         // random_itr_info_
         play.random_itr_info_    = random_itr_info_;
         //
+        // skip_run_
+        play.skip_run_           = skip_run_;
+        //
         return play;
     }
     //
@@ -564,6 +598,9 @@ public:
         //
         // random_itr_info_
         random_itr_info_.swap(    other.random_itr_info_);
+        //
+        // skip_run_
+        skip_run_.swap(           other.skip_run_);
     }
     //
     // setup_random
@@ -668,6 +705,10 @@ public:
     const Base* par_ptr(void) const
     {   return dyn_play_.par_ptr(); }
     //
+    // skip_run
+    const play::skip_run_t& skip_run(void) const
+    {   return skip_run_; }
+    //
     // GetTxt
     /*!
     \brief
@@ -747,6 +788,42 @@ public:
     size_t size_random(void) const
     {   return random_itr_info_.size(); }
     //
+    // memory_report
+    // Append one element to report for each vector in this player
+    // (including the vectors in dyn_play_). The element type must have a
+    // std::string field name and a size_t field bytes.
+    // In user api as f.memory_report(); see the file memory_report.hpp.
+    template <class RecordVector>
+    void memory_report(RecordVector& report) const
+    {   typename RecordVector::value_type record;
+        //
+        record.name  = "var_op";
+        record.bytes = var_op_.capacity() * sizeof(opcode_t);
+        report.push_back(record);
+        //
+        record.name  = "var_arg";
+        record.bytes = var_arg_.capacity() * sizeof(addr_t);
+        report.push_back(record);
+        //
+        record.name  = "var_text";
+        record.bytes = var_text_.capacity() * sizeof(char);
+        report.push_back(record);
+        //
+        record.name  = "var_vecad_ind";
+        record.bytes = var_vecad_ind_.capacity() * sizeof(addr_t);
+        report.push_back(record);
+        //
+        record.name  = "random_itr_info";
+        record.bytes = random_itr_info_.memory();
+        report.push_back(record);
+        //
+        record.name  = "skip_run";
+        record.bytes = skip_run_.size();
+        report.push_back(record);
+        //
+        dyn_play_.memory_report(report);
+    }
+    //
     // begin
     /// const sequential iterator begin
     play::const_sequential_iterator begin(void) const
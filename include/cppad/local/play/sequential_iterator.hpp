@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_SEQUENTIAL_ITERATOR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
@@ -157,6 +157,28 @@ public:
         return *this;
     }
     /*!
+    Move iterator to a specified operator
+
+    \param op_index
+    is the index of the operator that the iterator is moved to.
+
+    \param arg_index
+    is the index, in the vector of arguments for all the operators,
+    of the first argument for this operator.
+
+    \param var_index
+    is the value var_index returned by op_info when this iterator
+    is advanced sequentially to this operator.
+    */
+    void jump(size_t op_index, size_t arg_index, size_t var_index)
+    {   CPPAD_ASSERT_UNKNOWN( op_begin_ + op_index < op_end_ );
+        CPPAD_ASSERT_UNKNOWN( arg_begin_ + arg_index <= arg_end_ );
+        op_cur_    = op_begin_ + op_index;
+        op_        = op_code_var( *op_cur_ );
+        arg_       = arg_begin_ + arg_index;
+        var_index_ = var_index;
+    }
+    /*!
     Correction applied before ++ operation when current operator
     is CSumOp, CSkipOp, or AFunOP.
     */
@@ -0,0 +1,317 @@
+# ifndef CPPAD_LOCAL_PLAY_SKIP_RUN_HPP
+# define CPPAD_LOCAL_PLAY_SKIP_RUN_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/local/play/sequential_iterator.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file skip_run.hpp
+*/
+
+/*!
+Runs of contiguous operators that a conditional skip operator can skip.
+
+\par
+Each CSkipOp has a list of operators to skip when its comparison is true
+and another list when its comparison is false; see var_cskip_op.
+A run is a sequence of two or more operators, with contiguous indices,
+that are all in one of these lists.
+If the corresponding CSkipOp was evaluated and its comparison had the
+corresponding result, every operator in the run is skipped. In this case,
+a sequential sweep can jump over the entire run in constant time.
+
+\par
+Operators that are part of an atomic function call are not included in runs.
+A run must come after its CSkipOp in the operation sequence.
+*/
+class skip_run_t {
+public:
+    /// the fields for each run in the run_ vector
+    enum field_enum {
+        /// CSkipOp arg[0], arg[1], arg[2], arg[3] (the comparison)
+        compare_field  = 0,
+        /// operator index of the CSkipOp
+        cskip_op_field = 4,
+        /// 1 (2) if the run is in the true (false) list for the CSkipOp
+        branch_field   = 5,
+        /// operator index for first operator in the run
+        first_op_field = 6,
+        /// sequential iterator arg index for first operator after an --
+        first_arg_field = 7,
+        /// sequential iterator var_index for first operator
+        first_var_field = 8,
+        /// operator index for last operator in the run
+        last_op_field  = 9,
+        /// sequential iterator arg index for last operator after a ++
+        last_arg_field = 10,
+        /// sequential iterator var_index for last operator
+        last_var_field = 11,
+        /// number of fields for each run
+        n_field        = 12
+    };
+private:
+    /// maps operator index to run index + 1 for runs that start there
+    /// (zero if no run starts there). Empty if there are no runs.
+    pod_vector<addr_t> first2run_;
+    /// maps operator index to run index + 1 for runs that end there
+    /// (zero if no run ends there). Empty if there are no runs.
+    pod_vector<addr_t> last2run_;
+    /// the fields for run index i_run start at run_[ n_field * i_run ]
+    pod_vector<addr_t> run_;
+public:
+    /// swap
+    void swap(skip_run_t& other)
+    {   first2run_.swap( other.first2run_ );
+        last2run_.swap( other.last2run_ );
+        run_.swap( other.run_ );
+    }
+    /// clear
+    void clear(void)
+    {   first2run_.clear();
+        last2run_.clear();
+        run_.clear();
+    }
+    /// number of runs
+    size_t n_run(void) const
+    {   return run_.size() / n_field; }
+    /// number of bytes allocated for this object
+    size_t size(void) const
+    {   size_t capacity = first2run_.capacity() + last2run_.capacity();
+        capacity       += run_.capacity();
+        return capacity * sizeof(addr_t);
+    }
+    /*!
+    Run that starts at an operator
+
+    \param i_op
+    is the operator index.
+
+    \return
+    is a pointer to the fields for a run that starts at i_op
+    (nullptr if there is no such run).
+    */
+    const addr_t* first(size_t i_op) const
+    {   if( first2run_.size() == 0 )
+            return nullptr;
+        size_t i_run = size_t( first2run_[i_op] );
+        if( i_run == 0 )
+            return nullptr;
+        return run_.data() + n_field * (i_run - 1);
+    }
+    /*!
+    Run that ends at an operator
+
+    \param i_op
+    is the operator index.
+
+    \return
+    is a pointer to the fields for a run that ends at i_op
+    (nullptr if there is no such run).
+    */
+    const addr_t* last(size_t i_op) const
+    {   if( last2run_.size() == 0 )
+            return nullptr;
+        size_t i_run = size_t( last2run_[i_op] );
+        if( i_run == 0 )
+            return nullptr;
+        return run_.data() + n_field * (i_run - 1);
+    }
+    /*!
+    Set the runs for an operation sequence
+
+    \param num_var
+    is the number of variables in the operation sequence.
+
+    \param var_op
+    is the vector of operators in the operation sequence.
+
+    \param var_arg
+    is the vector of arguments for all the operators.
+    */
+    void set(
+        size_t                      num_var ,
+        const pod_vector<opcode_t>& var_op  ,
+        const pod_vector<addr_t>&   var_arg )
+    {   clear();
+        size_t num_op = var_op.size();
+        //
+        // check for a CSkipOp
+        bool has_cskip = false;
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+            has_cskip |= op_code_var( var_op[i_op] ) == CSkipOp;
+        if( ! has_cskip )
+            return;
+        //
+        // op2arg, op2var, in_atom
+        // op2arg[i_op]: sequential iterator arg index for operator i_op.
+        // op2var[i_op]: sequential iterator var_index for operator i_op.
+        // in_atom[i_op]: is operator i_op part of an atomic function call.
+        pod_vector<addr_t> op2arg(num_op + 1), op2var(num_op);
+        pod_vector<bool>   in_atom(num_op);
+        const_sequential_iterator itr(num_var, &var_op, &var_arg, 0);
+        op_code_var   op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        bool atom_call = false;
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+        {   CPPAD_ASSERT_UNKNOWN( itr.op_index() == i_op );
+            op2arg[i_op] = addr_t( arg - var_arg.data() );
+            op2var[i_op] = addr_t( i_var );
+            if( op == AFunOp )
+                atom_call = ! atom_call;
+            in_atom[i_op] = atom_call || op == AFunOp;
+            if( op == CSkipOp || op == CSumOp )
+                itr.correct_before_increment();
+            if( op != EndOp )
+                (++itr).op_info(op, arg, i_var);
+        }
+        op2arg[num_op] = addr_t( var_arg.size() );
+        CPPAD_ASSERT_UNKNOWN( ! atom_call );
+        //
+        // first2run_, last2run_
+        first2run_.resize(num_op);
+        last2run_.resize(num_op);
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+        {   first2run_[i_op] = 0;
+            last2run_[i_op]  = 0;
+        }
+        //
+        // run_
+        for(size_t i_cskip = 0; i_cskip < num_op; ++i_cskip)
+        if( op_code_var( var_op[i_cskip] ) == CSkipOp )
+        {   arg = var_arg.data() + op2arg[i_cskip];
+            for(size_t branch = 1; branch <= 2; ++branch)
+            {   //
+                // list, n_list
+                // operators to skip for this branch
+                const addr_t* list   = arg + 6;
+                size_t        n_list = size_t( arg[4] );
+                if( branch == 2 )
+                {   list   = arg + 6 + arg[4];
+                    n_list = size_t( arg[5] );
+                }
+                size_t k = 0;
+                while( k < n_list )
+                {   //
+                    // i_first, i_last
+                    size_t i_first = size_t( list[k++] );
+                    size_t i_last  = i_first;
+                    bool   ok      = i_cskip < i_first && ! in_atom[i_first];
+                    while( ok && k < n_list &&
+                        size_t( list[k] ) == i_last + 1 &&
+                        ! in_atom[i_last + 1] )
+                    {   i_last = size_t( list[k++] );
+                    }
+                    ok &= i_first < i_last;
+                    ok &= first2run_[i_first] == 0 || last2run_[i_last] == 0;
+                    if( ok )
+                    {   // i_run
+                        addr_t i_run = addr_t( n_run() + 1 );
+                        if( first2run_[i_first] == 0 )
+                            first2run_[i_first] = i_run;
+                        if( last2run_[i_last] == 0 )
+                            last2run_[i_last] = i_run;
+                        //
+                        // first_arg
+                        // arg index for i_first after -- to this operator
+                        op = op_code_var( var_op[i_first] );
+                        addr_t first_arg =
+                            op2arg[i_first + 1] - addr_t( NumArg(op) );
+                        //
+                        // run_
+                        for(size_t j = 0; j < 4; ++j)
+                            run_.push_back( arg[j] );
+                        run_.push_back( addr_t( i_cskip ) );
+                        run_.push_back( addr_t( branch ) );
+                        run_.push_back( addr_t( i_first ) );
+                        run_.push_back( first_arg );
+                        run_.push_back( op2var[i_first] );
+                        run_.push_back( addr_t( i_last ) );
+                        run_.push_back( op2arg[i_last] );
+                        run_.push_back( op2var[i_last] );
+                    }
+                }
+            }
+        }
+        if( n_run() == 0 )
+            clear();
+    }
+};
+/*!
+Run that ends at the current operator of an iterator
+
+\param skip_run
+is the information for the runs.
+
+\param itr
+is a sequential iterator.
+
+\return
+is a pointer to the fields for a run that ends at the current operator
+(nullptr if there is no such run).
+*/
+inline const addr_t* skip_run_last(
+    const skip_run_t&           skip_run ,
+    const_sequential_iterator&  itr      )
+{   return skip_run.last( itr.op_index() ); }
+/*!
+Run that ends at the current operator of an iterator
+
+\tparam Iterator
+is an iterator type that cannot jump; e.g., const_subgraph_iterator.
+
+\return
+is nullptr because this iterator cannot jump over a run.
+*/
+template <class Iterator>
+const addr_t* skip_run_last(
+    const skip_run_t&           skip_run ,
+    Iterator&                   itr      )
+{   return nullptr; }
+/*!
+Move an iterator backwards to the first operator in a run
+
+\param itr
+is a sequential iterator that is at the last operator in the run.
+Upon return it is at the first operator in the run as if
+it had been decremented to this operator.
+
+\param run
+is a pointer to the fields for the run.
+*/
+inline void skip_run_jump_first(
+    const_sequential_iterator&  itr ,
+    const addr_t*               run )
+{   CPPAD_ASSERT_UNKNOWN( itr.op_index() ==
+        size_t( run[skip_run_t::last_op_field] )
+    );
+    itr.jump(
+        size_t( run[skip_run_t::first_op_field] ) ,
+        size_t( run[skip_run_t::first_arg_field] ) ,
+        size_t( run[skip_run_t::first_var_field] )
+    );
+}
+/*!
+Move an iterator backwards to the first operator in a run
+
+\tparam Iterator
+is an iterator type that cannot jump; e.g., const_subgraph_iterator.
+This case is never used because skip_run_last returns nullptr
+for this iterator type.
+*/
+template <class Iterator>
+void skip_run_jump_first(
+    Iterator&                   itr ,
+    const addr_t*               run )
+{   CPPAD_ASSERT_UNKNOWN( false ); }
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
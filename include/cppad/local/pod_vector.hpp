@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_POD_VECTOR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # if CPPAD_CSTDINT_HAS_8_TO_64
@@ -340,6 +340,18 @@ resize
 #. If on input, *n* is greater than capacity\_ ,
    the elements in the vector are lost.
 
+reserve
+*******
+{xrst_literal
+    // BEGIN_RESERVE
+    // END_RESERVE
+}
+#. If on input, *n* is greater than capacity\_ ,
+   the capacity is increased to at least *n* .
+#. The size of the vector and the elements in the vector are not changed.
+#. This avoids repeated allocation and copying when the vector
+   is extended many times and its final size is known in advance.
+
 clear
 *****
 {xrst_literal
@@ -410,6 +422,32 @@ and frees all the memory that it was using.
         }
         CPPAD_ASSERT_UNKNOWN( size_ <= capacity_ );
     }
+    // BEGIN_RESERVE
+    void reserve(size_t n)
+    // END_RESERVE
+    {   if( n <= capacity_ )
+            return;
+        //
+        // save old information
+        size_t old_capacity = capacity_;
+        void* old_v_ptr     = reinterpret_cast<void*>(data_);
+        //
+        // get new memory and set capacity
+        size_t byte_capacity;
+        size_t bytes = n * sizeof(Type);
+        void* v_ptr  = thread_alloc::get_memory(bytes, byte_capacity);
+        capacity_    = byte_capacity / sizeof(Type);
+        data_        = reinterpret_cast<Type*>(v_ptr);
+        //
+        // copy old data to new
+        if( size_ > 0 )
+            std::memcpy(v_ptr, old_v_ptr, size_ * sizeof(Type));
+        //
+        // return old memory to available pool
+        if( old_capacity > 0 )
+            thread_alloc::return_memory(old_v_ptr);
+        CPPAD_ASSERT_UNKNOWN( n <= capacity_ );
+    }
     // BEGIN_CLEAR
     void clear(void)
     // END_CLEAR
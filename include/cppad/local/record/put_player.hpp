@@ -0,0 +1,555 @@
+# ifndef CPPAD_LOCAL_RECORD_PUT_PLAYER_HPP
+# define CPPAD_LOCAL_RECORD_PUT_PLAYER_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/local/record/recorder.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*
+------------------------------------------------------------------------------
+{xrst_begin recorder_put_player dev}
+{xrst_spell
+    dyn
+    pri
+}
+
+Append the Operation Sequence in a Player to a Recording
+########################################################
+
+Syntax
+******
+| *rec* . ``put_player`` ( *play* , *dyn_ind* , *var_ind* , *var_map* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PUT_PLAYER
+    // END_PUT_PLAYER
+}
+
+Purpose
+*******
+This copies the operations in *play* to the end of *rec* without
+re-evaluating the function that was used to create *play* .
+The independent dynamic parameters and independent variables in *play*
+are replaced by parameters and variables that are already in *rec* .
+This is used to splice and compose :ref:`ADFun-name` objects.
+
+rec
+***
+The parameter with index zero in *rec* must be nan and the first
+operator in *rec* must be a BeginOp.
+The EndOp has not yet been placed in *rec* .
+
+play
+****
+is the player containing the operation sequence that is appended to *rec* .
+Its constant parameters are added to the parameters in *rec*
+(using the hash code to avoid duplicates).
+Its dependent dynamic parameters, variables, VecAD vectors, and
+text used by PriOp are added to *rec* .
+The BeginOp, InvOp and EndOp operators in *play* are not copied.
+
+dyn_ind
+*******
+This vector has size *play* . ``n_dyn_independent`` () .
+The *j*-th independent dynamic parameter in *play* is replaced by
+the parameter with index *dyn_ind* [ *j* ] in *rec* .
+
+var_ind
+*******
+The *j*-th independent variable in *play* is replaced by
+the variable with index *var_ind* [ *j* ] in *rec* .
+The size of this vector is the number of independent variables in *play* .
+
+var_map
+*******
+The input size and contents of this vector do not matter.
+Upon return, it has size *play* . ``num_var`` () .
+If *i* is the index of the primary (last) result of an operator in *play*,
+*var_map* [ *i* ] is the index of the corresponding variable in *rec* .
+
+CSkipOp
+*******
+The operator indices in the conditional skip lists are mapped to the
+corresponding operator indices in *rec* .
+
+{xrst_end recorder_put_player}
+*/
+// BEGIN_PUT_PLAYER
+template <class Base>
+void recorder<Base>::put_player(
+    const player<Base>&       play    ,
+    const pod_vector<addr_t>& dyn_ind ,
+    const pod_vector<addr_t>& var_ind ,
+    pod_vector<addr_t>&       var_map )
+// END_PUT_PLAYER
+{   CPPAD_ASSERT_UNKNOWN( var_op_.size() > 0 );
+    CPPAD_ASSERT_UNKNOWN( CppAD::isnan( par_all()[0] ) );
+    //
+    // dynamic parameter information in play
+    size_t num_par                      = play.num_par_all();
+    size_t n_dyn_independent            = play.n_dyn_independent();
+    const pod_vector<bool>&   par_is_dyn  = play.par_is_dyn();
+    const pod_vector<opcode_t>& dyn_par_op = play.dyn_par_op();
+    const pod_vector<addr_t>& dyn_par_arg = play.dyn_par_arg();
+    CPPAD_ASSERT_UNKNOWN( dyn_ind.size() == n_dyn_independent );
+    //
+    // new_par
+    // mapping from parameter index in play to parameter index in rec
+    pod_vector<addr_t> new_par(num_par);
+    CPPAD_ASSERT_UNKNOWN( ! par_is_dyn[0] && CppAD::isnan( play.par_one(0) ) );
+    new_par[0] = 0;
+    for(size_t i_par = 1; i_par <= n_dyn_independent; ++i_par)
+    {   CPPAD_ASSERT_UNKNOWN( par_is_dyn[i_par] );
+        new_par[i_par] = dyn_ind[i_par - 1];
+    }
+    for(size_t i_par = n_dyn_independent + 1; i_par < num_par; ++i_par)
+    if( ! par_is_dyn[i_par] )
+        new_par[i_par] = put_con_par( play.par_one(i_par) );
+    //
+    // new_par
+    // dependent dynamic parameters
+    size_t i_dyn = n_dyn_independent; // dynamic parameter index
+    size_t i_arg = 0;                 // dynamic parameter argument index
+    pod_vector<addr_t> arg_vec;
+    for(size_t i_par = n_dyn_independent + 1; i_par < num_par; ++i_par)
+    if( par_is_dyn[i_par] )
+    {   // op, n_arg, par
+        op_code_dyn op = op_code_dyn( dyn_par_op[i_dyn] );
+        size_t n_arg   = num_arg_dyn(op);
+        Base   par     = play.par_one(i_par);
+        //
+        switch( op )
+        {   //
+            // atom_dyn
+            // all the results for this call are recorded here
+            case atom_dyn:
+            {   size_t atom_n = size_t( dyn_par_arg[i_arg + 2] );
+                size_t atom_m = size_t( dyn_par_arg[i_arg + 3] );
+                n_arg         = 6 + atom_n + atom_m;
+                arg_vec.resize(0);
+                for(size_t j = 0; j < 5; ++j)
+                    arg_vec.push_back( dyn_par_arg[i_arg + j] );
+                for(size_t j = 0; j < atom_n; ++j)
+                {   // zero corresponds to a variable argument
+                    addr_t arg_j = dyn_par_arg[i_arg + 5 + j];
+                    arg_vec.push_back( new_par[arg_j] );
+                }
+                bool first_dynamic_result = true;
+                for(size_t i = 0; i < atom_m; ++i)
+                {   addr_t res_i = dyn_par_arg[i_arg + 5 + atom_n + i];
+                    if( par_is_dyn[res_i] )
+                    {   Base par_i = play.par_one( size_t(res_i) );
+                        if( first_dynamic_result )
+                        {   CPPAD_ASSERT_UNKNOWN( size_t(res_i) == i_par );
+                            first_dynamic_result = false;
+                            new_par[res_i] = put_dyn_par(par_i, atom_dyn);
+                        }
+                        else
+                            new_par[res_i] = put_dyn_par(par_i, result_dyn);
+                    }
+                    // zero corresponds to a variable result
+                    arg_vec.push_back( new_par[res_i] );
+                }
+                arg_vec.push_back( addr_t(n_arg) );
+                put_dyn_arg_vec( arg_vec );
+            }
+            break;
+            //
+            // result_dyn
+            // recorded with the corresponding atom_dyn
+            case result_dyn:
+            CPPAD_ASSERT_UNKNOWN( n_arg == 0 );
+            break;
+            //
+            // cond_exp_dyn
+            case cond_exp_dyn:
+            CPPAD_ASSERT_UNKNOWN( n_arg == 5 );
+            new_par[i_par] = put_dyn_cond_exp(
+                par                                ,   // par
+                CompareOp( dyn_par_arg[i_arg + 0] ),   // cop
+                new_par[ dyn_par_arg[i_arg + 1] ]  ,   // left
+                new_par[ dyn_par_arg[i_arg + 2] ]  ,   // right
+                new_par[ dyn_par_arg[i_arg + 3] ]  ,   // if_true
+                new_par[ dyn_par_arg[i_arg + 4] ]      // if_false
+            );
+            break;
+            //
+            // dis_dyn
+            case dis_dyn:
+            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+            new_par[i_par] = put_dyn_par(
+                par                               ,  // par
+                op                                ,  // op
+                dyn_par_arg[i_arg + 0]            ,  // index
+                new_par[ dyn_par_arg[i_arg + 1] ]    // parameter
+            );
+            break;
+            //
+            // unary and binary operators
+            default:
+            CPPAD_ASSERT_UNKNOWN( op != ind_dyn );
+            CPPAD_ASSERT_UNKNOWN( num_non_par_arg_dyn(op) == 0 );
+            if( n_arg == 1 )
+            {   new_par[i_par] = put_dyn_par( par, op,
+                    new_par[ dyn_par_arg[i_arg + 0] ]
+                );
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+                new_par[i_par] = put_dyn_par( par, op,
+                    new_par[ dyn_par_arg[i_arg + 0] ],
+                    new_par[ dyn_par_arg[i_arg + 1] ]
+                );
+            }
+            break;
+        }
+        ++i_dyn;
+        i_arg += n_arg;
+    }
+    CPPAD_ASSERT_UNKNOWN( i_dyn == play.num_dynamic_par() );
+    CPPAD_ASSERT_UNKNOWN( i_arg == play.num_dynamic_arg() );
+    //
+    // var_vecad_ind_
+    // vecad_offset: amount added to VecAD offsets in play
+    addr_t vecad_offset = addr_t( var_vecad_ind_.size() );
+    {   size_t num_vec_ind = play.num_var_vec_ind();
+        size_t j = 0;
+        while( j < num_vec_ind )
+        {   size_t length = play.GetVecInd(j);
+            put_var_vecad_ind( addr_t(length) );
+            for(size_t k = 1; k <= length; ++k)
+                put_var_vecad_ind( new_par[ play.GetVecInd(j + k) ] );
+            j += length + 1;
+        }
+        CPPAD_ASSERT_UNKNOWN( j == num_vec_ind );
+    }
+    //
+    // var_map, new_op, cskip_arg
+    // new_op: mapping from operator index in play to operator index in rec
+    // cskip_arg: index in var_arg_ of first argument for each CSkipOp copied
+    size_t num_op = play.num_var_op();
+    var_map.resize( play.num_var() );
+    pod_vector<addr_t> new_op(num_op);
+    pod_vector<size_t> cskip_arg;
+    //
+    // itr, op, arg, i_var
+    play::const_sequential_iterator itr = play.begin();
+    op_code_var   op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    var_map[0] = 0;
+    new_op[0]  = 0;
+    //
+    // i_ind: index of next independent variable
+    size_t i_ind  = 0;
+    //
+    // new_arg: temporary buffer for new argument values
+    addr_t new_arg[6];
+    //
+    // mask: temporary used for parameter versus variable flags
+    addr_t mask;
+    //
+    while( op != EndOp )
+    {   //
+        // op, arg, i_var
+        (++itr).op_info(op, arg, i_var);
+        size_t i_op  = itr.op_index();
+        new_op[i_op] = addr_t( var_op_.size() );
+        //
+        switch( op )
+        {   // ----------------------------------------------------------------
+            // operators that are not copied
+
+            case EndOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 0);
+            break;
+
+            case InvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            CPPAD_ASSERT_UNKNOWN( i_ind < var_ind.size() );
+            var_map[i_var] = var_ind[i_ind++];
+            break;
+
+            // ----------------------------------------------------------------
+            // one variable argument
+            case AbsOp:
+            case AcosOp:
+            case AcoshOp:
+            case AsinOp:
+            case AsinhOp:
+            case AtanOp:
+            case AtanhOp:
+            case CosOp:
+            case CoshOp:
+            case ExpOp:
+            case Expm1Op:
+            case LogOp:
+            case Log1pOp:
+            case NegOp:
+            case SignOp:
+            case SinOp:
+            case SinhOp:
+            case SqrtOp:
+            case TanOp:
+            case TanhOp:
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            PutArg( var_map[ arg[0] ] );
+            var_map[i_var] = PutOp(op);
+            break;
+
+            // variable, parameter, parameter
+            case ErfOp:
+            case ErfcOp:
+            CPPAD_ASSERT_NARG_NRES(op, 3, 5);
+            PutArg( var_map[ arg[0] ], new_par[ arg[1] ], new_par[ arg[2] ] );
+            var_map[i_var] = PutOp(op);
+            break;
+
+            // parameter
+            case ParOp:
+            case FunapOp:
+            case FunrpOp:
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            PutArg( new_par[ arg[0] ] );
+            if( NumRes(op) > 0 )
+                var_map[i_var] = PutOp(op);
+            else
+                PutOp(op);
+            break;
+
+            // variable, no result
+            case FunavOp:
+            CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+            PutArg( var_map[ arg[0] ] );
+            PutOp(op);
+            break;
+
+            // no arguments
+            case FunrvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            var_map[i_var] = PutOp(op);
+            break;
+
+            // ----------------------------------------------------------------
+            // parameter, variable
+            case AddpvOp:
+            case DivpvOp:
+            case MulpvOp:
+            case PowpvOp:
+            case SubpvOp:
+            case ZmulpvOp:
+            case EqpvOp:
+            case LepvOp:
+            case LtpvOp:
+            case NepvOp:
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 2 );
+            PutArg( new_par[ arg[0] ], var_map[ arg[1] ] );
+            if( NumRes(op) > 0 )
+                var_map[i_var] = PutOp(op);
+            else
+                PutOp(op);
+            break;
+
+            // variable, parameter
+            case DivvpOp:
+            case PowvpOp:
+            case SubvpOp:
+            case ZmulvpOp:
+            case LevpOp:
+            case LtvpOp:
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 2 );
+            PutArg( var_map[ arg[0] ], new_par[ arg[1] ] );
+            if( NumRes(op) > 0 )
+                var_map[i_var] = PutOp(op);
+            else
+                PutOp(op);
+            break;
+
+            // variable, variable
+            case AddvvOp:
+            case DivvvOp:
+            case MulvvOp:
+            case PowvvOp:
+            case SubvvOp:
+            case ZmulvvOp:
+            case EqvvOp:
+            case LevvOp:
+            case LtvvOp:
+            case NevvOp:
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 2 );
+            PutArg( var_map[ arg[0] ], var_map[ arg[1] ] );
+            if( NumRes(op) > 0 )
+                var_map[i_var] = PutOp(op);
+            else
+                PutOp(op);
+            break;
+
+            // parameter, parameter
+            case EqppOp:
+            case LeppOp:
+            case LtppOp:
+            case NeppOp:
+            CPPAD_ASSERT_NARG_NRES(op, 2, 0);
+            PutArg( new_par[ arg[0] ], new_par[ arg[1] ] );
+            PutOp(op);
+            break;
+
+            // discrete function index, variable
+            case DisOp:
+            CPPAD_ASSERT_NARG_NRES(op, 2, 1);
+            PutArg( arg[0], var_map[ arg[1] ] );
+            var_map[i_var] = PutOp(op);
+            break;
+
+            // atomic index, call id, number of arguments, number of results
+            case AFunOp:
+            CPPAD_ASSERT_NARG_NRES(op, 4, 0);
+            PutArg( arg[0], arg[1], arg[2], arg[3] );
+            PutOp(op);
+            break;
+
+            // ----------------------------------------------------------------
+            case CExpOp:
+            CPPAD_ASSERT_NARG_NRES(op, 6, 1);
+            new_arg[0] = arg[0];
+            new_arg[1] = arg[1];
+            mask = 1;
+            for(size_t i = 2; i < 6; ++i)
+            {   if( arg[1] & mask )
+                    new_arg[i] = var_map[ arg[i] ];
+                else
+                    new_arg[i] = new_par[ arg[i] ];
+                mask = mask << 1;
+            }
+            PutArg(
+                new_arg[0], new_arg[1], new_arg[2],
+                new_arg[3], new_arg[4], new_arg[5]
+            );
+            var_map[i_var] = PutOp(op);
+            break;
+
+            // ----------------------------------------------------------------
+            case PriOp:
+            CPPAD_ASSERT_NARG_NRES(op, 5, 0);
+            new_arg[0] = arg[0];
+            if( arg[0] & 1 )
+                new_arg[1] = var_map[ arg[1] ];
+            else
+                new_arg[1] = new_par[ arg[1] ];
+            new_arg[2] = PutTxt( play.GetTxt( size_t(arg[2]) ) );
+            if( arg[0] & 2 )
+                new_arg[3] = var_map[ arg[3] ];
+            else
+                new_arg[3] = new_par[ arg[3] ];
+            new_arg[4] = PutTxt( play.GetTxt( size_t(arg[4]) ) );
+            PutArg(
+                new_arg[0], new_arg[1], new_arg[2], new_arg[3], new_arg[4]
+            );
+            PutOp(op);
+            break;
+
+            // ----------------------------------------------------------------
+            // VecAD operators
+            case LdpOp:
+            case LdvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 3, 1);
+            new_arg[0] = arg[0] + vecad_offset;
+            if( op == LdpOp )
+                new_arg[1] = new_par[ arg[1] ];
+            else
+                new_arg[1] = var_map[ arg[1] ];
+            new_arg[2] = addr_t( num_var_load_ );
+            PutArg( new_arg[0], new_arg[1], new_arg[2] );
+            var_map[i_var] = PutLoadOp(op);
+            break;
+
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 3, 0);
+            new_arg[0] = arg[0] + vecad_offset;
+            if( op == StppOp || op == StpvOp )
+                new_arg[1] = new_par[ arg[1] ];
+            else
+                new_arg[1] = var_map[ arg[1] ];
+            if( op == StppOp || op == StvpOp )
+                new_arg[2] = new_par[ arg[2] ];
+            else
+                new_arg[2] = var_map[ arg[2] ];
+            PutArg( new_arg[0], new_arg[1], new_arg[2] );
+            PutOp(op);
+            break;
+
+            // ----------------------------------------------------------------
+            // CSumOp
+            case CSumOp:
+            CPPAD_ASSERT_UNKNOWN( NumRes(op) == 1 );
+            {   size_t n_arg = size_t( arg[4] ) + 1;
+                size_t j_arg = var_arg_.extend(n_arg);
+                var_arg_[j_arg] = new_par[ arg[0] ];
+                for(size_t i = 1; i < 5; ++i)
+                    var_arg_[j_arg + i] = arg[i];
+                for(size_t i = 5; i < size_t( arg[2] ); ++i)
+                    var_arg_[j_arg + i] = var_map[ arg[i] ];
+                for(size_t i = size_t( arg[2] ); i < size_t( arg[4] ); ++i)
+                    var_arg_[j_arg + i] = new_par[ arg[i] ];
+                var_arg_[j_arg + n_arg - 1] = arg[n_arg - 1];
+            }
+            var_map[i_var] = PutOp(op);
+            itr.correct_before_increment();
+            break;
+
+            // ----------------------------------------------------------------
+            // CSkipOp
+            // the operator indices are mapped after all operators are copied
+            case CSkipOp:
+            CPPAD_ASSERT_UNKNOWN( NumRes(op) == 0 );
+            {   size_t n_arg = 7 + size_t( arg[4] ) + size_t( arg[5] );
+                size_t j_arg = var_arg_.extend(n_arg);
+                cskip_arg.push_back(j_arg);
+                for(size_t i = 0; i < n_arg; ++i)
+                    var_arg_[j_arg + i] = arg[i];
+                if( arg[1] & 1 )
+                    var_arg_[j_arg + 2] = var_map[ arg[2] ];
+                else
+                    var_arg_[j_arg + 2] = new_par[ arg[2] ];
+                if( arg[1] & 2 )
+                    var_arg_[j_arg + 3] = var_map[ arg[3] ];
+                else
+                    var_arg_[j_arg + 3] = new_par[ arg[3] ];
+            }
+            PutOp(op);
+            itr.correct_before_increment();
+            break;
+
+            // ----------------------------------------------------------------
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+            break;
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( i_ind == var_ind.size() );
+    //
+    // var_arg_
+    // map the operator indices in the conditional skip lists
+    for(size_t i = 0; i < cskip_arg.size(); ++i)
+    {   size_t j_arg = cskip_arg[i];
+        size_t n_skip = size_t( var_arg_[j_arg + 4] + var_arg_[j_arg + 5] );
+        for(size_t k = 0; k < n_skip; ++k)
+        {   addr_t& skip_op = var_arg_[j_arg + 6 + k];
+            CPPAD_ASSERT_UNKNOWN( new_op[skip_op] != 0 );
+            skip_op = new_op[skip_op];
+        }
+    }
+    return;
+}
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_RECORD_RECORDER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/core/hash_code.hpp>
 # include <cppad/local/pod_vector.hpp>
@@ -59,6 +59,18 @@ set_abort_op_index
     // END_SET_ABORT_OP_INDEX
 }
 
+reserve
+=======
+{xrst_literal
+    // BEGIN_RESERVE
+    // END_RESERVE
+}
+This reserves memory for *n_op* variable operators
+and for two times *n_op* operator arguments
+(most operators have one or two arguments).
+This avoids repeated allocation and copying of the operation sequence
+when its size is known in advance; e.g., from a previous recording.
+
 Getters
 *******
 
@@ -112,6 +124,7 @@ Contents
     include/cppad/local/record/put_var_vecad.hpp
     include/cppad/local/record/put_dyn_atomic.hpp
     include/cppad/local/record/put_var_atomic.hpp
+    include/cppad/local/record/put_player.hpp
     include/cppad/local/record/cond_exp.hpp
     include/cppad/local/record/comp_op.hpp
     include/cppad/local/record/dyn_recorder.hpp
@@ -248,6 +261,14 @@ public:
     // END_SET_ABORT_OP_INDEX
     {   abort_op_index_ = abort_op_index; }
     //
+    // BEGIN_RESERVE
+    // recorder.reserve(n_op)
+    void reserve(size_t n_op)
+    // END_RESERVE
+    {   var_op_.reserve(n_op);
+        var_arg_.reserve(2 * n_op);
+    }
+    //
     // BEGIN_GET_RECORD_COMPARE
     // record_compare = recorder.get_record_compare()
     bool get_record_compare(void) const
@@ -334,6 +355,14 @@ public:
         VectorAD&                   ay
     );
 
+    // put_player
+    void put_player(
+        const player<Base>&       play    ,
+        const pod_vector<addr_t>& dyn_ind ,
+        const pod_vector<addr_t>& var_ind ,
+        pod_vector<addr_t>&       var_map
+    );
+
     /// record a variable or dynamic parameter conditional expression
     void cond_exp(
         tape_id_t       tape_id     ,
@@ -784,6 +813,7 @@ template <class Base> addr_t recorder<Base>::PutTxt(const char *text)
 // member function implementations
 # include <cppad/local/record/put_var_vecad.hpp>
 # include <cppad/local/record/put_var_atomic.hpp>
+# include <cppad/local/record/put_player.hpp>
 # include <cppad/local/record/cond_exp.hpp>
 # include <cppad/local/record/comp_op.hpp>
 
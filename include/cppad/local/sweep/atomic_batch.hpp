@@ -0,0 +1,300 @@
+# ifndef CPPAD_LOCAL_SWEEP_ATOMIC_BATCH_HPP
+# define CPPAD_LOCAL_SWEEP_ATOMIC_BATCH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/sweep/call_atomic.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*
+------------------------------------------------------------------------------
+{xrst_begin sweep_atomic_batch dev}
+{xrst_spell
+    funav
+    funrv
+}
+
+Batch of Independent Zero Order Atomic Function Calls
+#####################################################
+
+Syntax
+******
+| ``atomic_batch`` < *Base* , *RecBase* > *batch* (
+| |tab| *par_for* , *num_var* , *cap_order* , *taylor*
+| )
+| *batch* . ``add`` ( *itr* , *play* , *parameter* )
+| *batch* . ``check`` ( *op* , *arg* )
+| *batch* . ``flush`` ()
+
+Purpose
+*******
+This is used by the :ref:`sweep_forward_0-name` sweep when
+:ref:`atomic_parallel-name` is not null.
+Instead of evaluating an atomic function call when it is reached,
+the call is added to a batch of pending calls.
+The pending calls are evaluated, using *par_for* ,
+just before an operator uses one of their results.
+Thus all the calls in a batch are independent of each other.
+If *par_for* is null, *batch* does not allocate any memory
+and it should not be used.
+
+par_for
+*******
+is the :ref:`atomic_parallel@par_for` function.
+
+num_var
+*******
+is the number of variables in the recording.
+
+cap_order
+*********
+is the maximum number of orders that will fit in *taylor* .
+
+taylor
+******
+The zero order Taylor coefficient for the variable with index *i*
+is *taylor* [ *i* * *cap_order* ] .
+The results for the pending calls are stored in *taylor* by ``flush`` .
+
+add
+***
+The iterator *itr* must correspond to the first AFunOp for an atomic
+function call.
+Upon return it corresponds to the second AFunOp for the call.
+If one of the FunavOp arguments is the result of a pending call,
+``flush`` is called before the call is added to the batch.
+The variables created by the FunrvOp operators for this call become
+pending results.
+
+check
+*****
+If *op* is not one of the atomic function call operators,
+and the operator *op* with arguments *arg* uses a pending result,
+``flush`` is called.
+
+flush
+*****
+Evaluate all the pending calls, store their results in *taylor* ,
+and clear the batch.
+
+{xrst_end sweep_atomic_batch}
+------------------------------------------------------------------------------
+*/
+template <class Base, class RecBase>
+class atomic_batch {
+private:
+    /// information for one pending atomic function call
+    struct call_struct {
+        /// index for this atomic function
+        size_t                atom_index;
+        /// call_id for this atomic function call
+        size_t                call_id;
+        /// parameter values for the arguments
+        vector<Base>          parameter_x;
+        /// type of each argument
+        vector<ad_type_enum>  type_x;
+        /// zero order Taylor coefficients for the arguments
+        vector<Base>          taylor_x;
+        /// zero order Taylor coefficients for the results
+        vector<Base>          taylor_y;
+        /// which results are variables
+        vector<bool>          variable_y;
+        /// variable index for results that are variables
+        vector<size_t>        index_y;
+    };
+    //
+    /// function that evaluates the pending calls
+    const atomic_parallel_for par_for_;
+    //
+    /// maximum number of orders that fit in taylor_
+    const size_t              cap_order_;
+    //
+    /// Taylor coefficients for all the variables
+    Base*                     taylor_;
+    //
+    /// the pending calls are call_[0], ... , call_[n_call_-1]
+    /// (call_ is not shrunk so its memory is reused)
+    vector<call_struct>       call_;
+    size_t                    n_call_;
+    //
+    /// is the corresponding variable the result of a pending call
+    pod_vector<bool>          pending_var_;
+    //
+    /// work space used by check
+    pod_vector<bool>          is_variable_;
+    //
+    /// evaluate one of the pending calls (called by par_for_)
+    static void evaluate(size_t i_call, void* info)
+    {   atomic_batch* batch = reinterpret_cast<atomic_batch*>(info);
+        call_struct&  call  = batch->call_[i_call];
+        //
+        size_t need_y    = size_t(variable_enum);
+        size_t order_low = 0;
+        size_t order_up  = 0;
+        call_atomic_forward<Base, RecBase>(
+            call.parameter_x,
+            call.type_x,
+            need_y,
+            call.variable_y,
+            order_low,
+            order_up,
+            call.atom_index,
+            call.call_id,
+            call.taylor_x,
+            call.taylor_y
+        );
+    }
+public:
+    /// constructor
+    atomic_batch(
+        atomic_parallel_for par_for   ,
+        size_t              num_var   ,
+        size_t              cap_order ,
+        Base*               taylor    )
+    : par_for_(par_for), cap_order_(cap_order), taylor_(taylor), n_call_(0)
+    {   // pending_var_
+        // this batch is not used when par_for is null
+        if( par_for == nullptr )
+            return;
+        pending_var_.resize(num_var);
+        for(size_t i = 0; i < num_var; ++i)
+            pending_var_[i] = false;
+    }
+    //
+    /// evaluate all the pending calls
+    void flush(void)
+    {   if( n_call_ == 0 )
+            return;
+        //
+        // call_[i].taylor_y
+        if( n_call_ == 1 )
+            evaluate(0, reinterpret_cast<void*>(this) );
+        else
+            par_for_(n_call_, evaluate, reinterpret_cast<void*>(this) );
+        //
+        // taylor_, pending_var_
+        for(size_t i_call = 0; i_call < n_call_; ++i_call)
+        {   const call_struct& call = call_[i_call];
+            for(size_t i = 0; i < call.index_y.size(); ++i)
+            {   if( call.variable_y[i] )
+                {   size_t i_var = call.index_y[i];
+                    taylor_[i_var * cap_order_] = call.taylor_y[i];
+                    pending_var_[i_var]         = false;
+                }
+            }
+        }
+        n_call_ = 0;
+    }
+    //
+    /// flush if the operator op uses a pending result
+    void check(op_code_var op, const addr_t* arg)
+    {   if( n_call_ == 0 )
+            return;
+        arg_is_variable(op, arg, is_variable_);
+        for(size_t j = 0; j < is_variable_.size(); ++j)
+        {   if( is_variable_[j] && pending_var_[ arg[j] ] )
+            {   flush();
+                return;
+            }
+        }
+    }
+    //
+    /// add an atomic function call to the pending calls
+    void add(
+        play::const_sequential_iterator& itr        ,
+        const player<Base>*              play       ,
+        const Base*                      parameter  )
+    {   //
+        // par_is_dyn
+        const pod_vector<bool>& par_is_dyn( play->par_is_dyn() );
+        //
+        // op_code, i_var, arg
+        op_code_var   op_code;
+        size_t        i_var;
+        const addr_t* arg;
+        itr.op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+        //
+        // atom_index, call_id, m, n
+        size_t atom_index, call_id, m, n;
+        play::atom_op_info<RecBase>(op_code, arg, atom_index, call_id, m, n);
+        //
+        // itr_arg
+        // iterator corresponding to the first AFunOp
+        play::const_sequential_iterator itr_arg;
+        itr_arg = itr;
+        //
+        // flush
+        // if one of the arguments is a pending result
+        for(size_t j = 0; j < n; ++j)
+        {   (++itr).op_info(op_code, arg, i_var);
+            if( op_code == FunavOp && pending_var_[ arg[0] ] )
+                flush();
+        }
+        //
+        // call_, n_call_
+        if( call_.size() <= n_call_ )
+            call_.resize(n_call_ + 1);
+        call_struct& call = call_[n_call_];
+        ++n_call_;
+        //
+        // call
+        call.atom_index = atom_index;
+        call.call_id    = call_id;
+        call.parameter_x.resize(n);
+        call.type_x.resize(n);
+        call.taylor_x.resize(n);
+        call.taylor_y.resize(m);
+        call.variable_y.resize(m);
+        call.index_y.resize(m);
+        for(size_t j = 0; j < n; ++j)
+        {   (++itr_arg).op_info(op_code, arg, i_var);
+            if( op_code == FunapOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                if( par_is_dyn[ arg[0] ] )
+                    call.type_x[j] = dynamic_enum;
+                else
+                    call.type_x[j] = constant_enum;
+                call.parameter_x[j] = parameter[ arg[0] ];
+                call.taylor_x[j]    = parameter[ arg[0] ];
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunavOp );
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_var() );
+                call.type_x[j]      = variable_enum;
+                call.parameter_x[j] = CppAD::numeric_limits<Base>::quiet_NaN();
+                call.taylor_x[j]    = taylor_[ size_t(arg[0]) * cap_order_ ];
+            }
+        }
+        CPPAD_ASSERT_UNKNOWN( itr_arg.op_index() == itr.op_index() );
+        //
+        // call, pending_var_
+        for(size_t i = 0; i < m; ++i)
+        {   (++itr).op_info(op_code, arg, i_var);
+            if( op_code == FunrpOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                call.variable_y[i] = false;
+                call.index_y[i]    = std::numeric_limits<size_t>::max();
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunrvOp );
+                CPPAD_ASSERT_UNKNOWN( 0 < i_var );
+                call.variable_y[i]  = true;
+                call.index_y[i]     = i_var;
+                pending_var_[i_var] = true;
+            }
+        }
+        //
+        // itr
+        (++itr).op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+    }
+};
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_DYNAMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -70,6 +70,14 @@ lower than the index value for the parameter.
 
 \param not_used_rec_base
 Specifies RecBase for this call.
+
+\param select_ind
+If this is null, all the dynamic parameters are computed.
+Otherwise, it has size equal to the number of independent dynamic parameters
+and only the independent dynamic parameters j with select_ind[j] true
+have changed. In this case, only the dynamic parameters that depend on
+these independent dynamic parameters are computed.
+The other dynamic parameters keep their values in par_all.
 */
 
 template <class RecBase>
@@ -91,11 +99,22 @@ void dynamic(
     const pod_vector<addr_t>&     dyn2par_index      ,
     const pod_vector<opcode_t>&   dyn_par_op         ,
     const pod_vector<addr_t>&     dyn_par_arg        ,
-    const RecBase&                not_used_rec_base  )
+    const RecBase&                not_used_rec_base  ,
+    const pod_vector<bool>*       select_ind         )
 {
     // number of dynamic parameters
     size_t num_dynamic_par = dyn2par_index.size();
 
+    // par_change
+    // if select_ind is not null, flags parameters that may have changed
+    pod_vector<bool> par_change;
+    if( select_ind != nullptr )
+    {   CPPAD_ASSERT_UNKNOWN( select_ind->size() == ind_dynamic.size() );
+        par_change.resize( par_all.size() );
+        for(size_t i = 0; i < par_all.size(); ++i)
+            par_change[i] = false;
+    }
+
     // vectors used in call to atomic functions
     vector<ad_type_enum> type_x;
     vector<Base>         taylor_x, taylor_y;
@@ -151,6 +170,55 @@ void dynamic(
         // number of arguments for this operator
         size_t n_arg       = num_arg_dyn(op);
         //
+        // skip this operator if none of its arguments changed
+        if( select_ind != nullptr )
+        {   bool change = false;
+            switch(op)
+            {   case ind_dyn:
+                change = (*select_ind)[i_dyn];
+                break;
+
+                case dis_dyn:
+                change = par_change[ dyn_par_arg[i_arg + 1] ];
+                break;
+
+                case cond_exp_dyn:
+                for(size_t j = 1; j < n_arg; ++j)
+                    change |= par_change[ dyn_par_arg[i_arg + j] ];
+                break;
+
+                case result_dyn:
+                break;
+
+                case atom_dyn:
+                {   size_t n = size_t( dyn_par_arg[i_arg + 2] );
+                    size_t m = size_t( dyn_par_arg[i_arg + 3] );
+                    n_dyn    = size_t( dyn_par_arg[i_arg + 4] );
+                    n_arg    = 6 + n + m;
+                    for(size_t j = 0; j < n; ++j)
+                        change |= par_change[ dyn_par_arg[i_arg + 5 + j] ];
+                    if( change )
+                    {   for(size_t i = 0; i < m; ++i)
+                        {   size_t k = size_t( dyn_par_arg[i_arg + 5 + n + i] );
+                            par_change[k] = par_is_dyn[k];
+                        }
+                    }
+                }
+                break;
+
+                default:
+                for(size_t j = 0; j < n_arg; ++j)
+                    change |= par_change[ dyn_par_arg[i_arg + j] ];
+                break;
+            }
+            if( ! change )
+            {   i_arg += n_arg;
+                i_dyn += n_dyn;
+                continue;
+            }
+            par_change[i_par] = true;
+        }
+        //
         // for unary or binary operators
         bool unary_or_binary = true;
         unary_or_binary &= op != atom_dyn;
@@ -0,0 +1,585 @@
+# ifndef CPPAD_LOCAL_SWEEP_EDGE_PUSH_HPP
+# define CPPAD_LOCAL_SWEEP_EDGE_PUSH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <map>
+# include <cmath>
+# include <cppad/local/pod_vector.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/edge_push.hpp
+Compute sparse Hessians using the edge pushing algorithm.
+*/
+
+/*!
+Determine if the edge pushing algorithm supports an operation sequence.
+
+\tparam Base
+this operation sequence was recorded using AD<Base>.
+
+\param play
+is the operation sequence.
+
+\return
+is true if the local first and second partials are available for every
+operator in the operation sequence; i.e., it does not contain
+atomic functions, VecAD operations, or azmul operations.
+*/
+template <class Base>
+bool edge_push_supported(const local::player<Base>* play)
+{   size_t num_var_op = play->num_var_op();
+    for(size_t i_op = 0; i_op < num_var_op; ++i_op)
+    {   switch( play->GetOp(i_op) )
+        {
+            case AFunOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            case LdpOp:
+            case LdvOp:
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            case ZmulpvOp:
+            case ZmulvpOp:
+            case ZmulvvOp:
+            return false;
+
+            default:
+            break;
+        }
+    }
+    return true;
+}
+
+/*!
+Add a value to one element of the symmetric matrix W.
+
+\param W
+is the matrix. W[i] contains the non-zero elements in row i.
+
+\param i
+is the row index.
+
+\param j
+is the column index.
+
+\param value
+is added to W(i, j).
+*/
+template <class Base>
+void edge_push_add(
+    vector< std::map<size_t, Base> >& W     ,
+    size_t                            i     ,
+    size_t                            j     ,
+    const Base&                       value )
+{   typename std::map<size_t, Base>::iterator itr =
+        W[i].insert( std::make_pair(j, Base(0.0)) ).first;
+    itr->second += value;
+}
+
+/*!
+Compute the Hessian of w^T F(x) using the edge pushing algorithm.
+
+The variables are processed in reverse order.
+For each variable, its row of the symmetric matrix W of second order
+partials is pushed onto the arguments of the corresponding operator,
+the second order partials of the operator times the first order partial
+for the variable are created, and the variable is removed from W.
+Only the non-zero elements of W are stored,
+so the work is proportional to the number of non-zeros in W
+(and not the number of colors required by sparse_hes).
+
+\tparam Base
+this operation sequence was recorded using AD<Base>.
+
+\param num_var
+is the total number of variables on the tape; i.e.,
+ play->num_var().
+
+\param play
+is the operation sequence.
+It must be supported; see edge_push_supported.
+
+\param J
+is the number of Taylor coefficients per variable in taylor.
+
+\param taylor
+For i = 0 , ... , num_var - 1, taylor[ i * J ] is the
+zero order Taylor coefficient for the variable with index i.
+
+\param cskip_op
+Is a vector with size play->num_var_op().
+If cskip_op[i] is true, the operator index i in the recording
+does not affect any of the dependent variable.
+
+\param dep_taddr
+is the variable index for each of the dependent variables.
+
+\param w
+is a vector with the same size as dep_taddr.
+It is the weighting for each of the dependent variables.
+
+\param W
+\b Input: it has size num_var and all its rows are empty.
+\n
+\b Output: For j = 1 , ... , n, where n is the number of independent
+variables, W[j] contains the non-zero elements in the corresponding row
+of the Hessian of w^T F(x).
+The index for each element is the variable index for the corresponding
+independent variable.
+The values in the other rows are not specified.
+*/
+template <class Base>
+void edge_push(
+    size_t                            num_var   ,
+    const local::player<Base>*        play      ,
+    size_t                            J         ,
+    const Base*                       taylor    ,
+    const bool*                       cskip_op  ,
+    const pod_vector<size_t>&         dep_taddr ,
+    const vector<Base>&               w         ,
+    vector< std::map<size_t, Base> >& W         )
+{   //
+    CPPAD_ASSERT_UNKNOWN( play->num_var() == num_var );
+    CPPAD_ASSERT_UNKNOWN( W.size() == num_var );
+    CPPAD_ASSERT_UNKNOWN( dep_taddr.size() == w.size() );
+    //
+    // parameter
+    const Base* parameter = play->par_ptr();
+    //
+    // zero, one
+    const Base zero(0.0);
+    const Base one(1.0);
+    const Base two(2.0);
+    //
+    // adjoint
+    // first order partial of w^T F w.r.t. each variable
+    pod_vector_maybe<Base> adjoint(num_var);
+    for(size_t i = 0; i < num_var; ++i)
+        adjoint[i] = zero;
+    for(size_t i = 0; i < dep_taddr.size(); ++i)
+        adjoint[ dep_taddr[i] ] += w[i];
+    //
+    // arg_var, d1, d2
+    // variables that are arguments for the current operator,
+    // the first order partials w.r.t. these arguments, and the
+    // second order partials when there are at most two such arguments.
+    pod_vector<size_t>     arg_var;
+    pod_vector_maybe<Base> d1;
+    Base                   d2[2][2];
+    //
+    op_code_var   op;
+    const addr_t* arg;
+    size_t        i_var;
+    play::const_sequential_iterator play_itr = play->end();
+    play_itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == EndOp );
+    while( op != BeginOp )
+    {   //
+        // next op
+        (--play_itr).op_info(op, arg, i_var);
+        if( op == CSumOp || op == CSkipOp )
+            play_itr.correct_after_decrement(arg);
+        //
+        // skip operators that do not affect the dependent variables
+        size_t i_op = play_itr.op_index();
+        if( cskip_op[i_op] )
+            continue;
+        //
+        // skip operators that do not have a result
+        if( NumRes(op) == 0 || op == BeginOp || op == InvOp )
+            continue;
+        //
+        // z, x, y
+        // value of the result and the first two arguments
+        // (x and y are only used when the argument is a variable)
+        Base z = taylor[ i_var * J ];
+        Base x = zero, y = zero;
+        //
+        arg_var.resize(0);
+        d1.resize(0);
+        bool nonlinear = false;
+        //
+        // unary operators with a variable argument arg[0],
+        // aux is the auxiliary result (when there is one)
+        bool unary;
+        switch( op )
+        {   case AbsOp:   case AcosOp:  case AcoshOp: case AsinOp:
+            case AsinhOp: case AtanOp:  case AtanhOp: case CosOp:
+            case CoshOp:  case ErfOp:   case ErfcOp:  case ExpOp:
+            case Expm1Op: case LogOp:   case Log1pOp: case NegOp:
+            case SignOp:  case SinOp:   case SinhOp:  case SqrtOp:
+            case TanOp:   case TanhOp:
+            unary = true;
+            break;
+
+            default:
+            unary = false;
+            break;
+        }
+        Base aux = zero;
+        if( unary )
+        {   x   = taylor[ size_t(arg[0]) * J ];
+            if( NumRes(op) > 1 )
+                aux = taylor[ (i_var - 1) * J ];
+            arg_var.push_back( size_t(arg[0]) );
+            d1.push_back(zero);
+            nonlinear = true;
+            d2[0][0]  = zero;
+        }
+        switch( op )
+        {   // ---------------------------------------------------------------
+            // unary operators
+            case AbsOp:
+            d1[0]     = sign(x);
+            nonlinear = false;
+            break;
+
+            case AcosOp:
+            // aux = sqrt(1 - x * x)
+            d1[0]    = - one / aux;
+            d2[0][0] = - x / (aux * aux * aux);
+            break;
+
+            case AcoshOp:
+            // aux = sqrt(x * x - 1)
+            d1[0]    = one / aux;
+            d2[0][0] = - x / (aux * aux * aux);
+            break;
+
+            case AsinOp:
+            // aux = sqrt(1 - x * x)
+            d1[0]    = one / aux;
+            d2[0][0] = x / (aux * aux * aux);
+            break;
+
+            case AsinhOp:
+            // aux = sqrt(1 + x * x)
+            d1[0]    = one / aux;
+            d2[0][0] = - x / (aux * aux * aux);
+            break;
+
+            case AtanOp:
+            // aux = 1 + x * x
+            d1[0]    = one / aux;
+            d2[0][0] = - two * x / (aux * aux);
+            break;
+
+            case AtanhOp:
+            // aux = 1 - x * x
+            d1[0]    = one / aux;
+            d2[0][0] = two * x / (aux * aux);
+            break;
+
+            case CosOp:
+            // aux = sin(x)
+            d1[0]    = - aux;
+            d2[0][0] = - z;
+            break;
+
+            case CoshOp:
+            // aux = sinh(x)
+            d1[0]    = aux;
+            d2[0][0] = z;
+            break;
+
+            case ErfOp:
+            case ErfcOp:
+            {   // 2 / sqrt(pi)
+                Base two_sqrt_pi( 2.0 / std::sqrt( 4.0 * std::atan(1.0) ) );
+                Base e   = two_sqrt_pi * exp( - x * x );
+                d1[0]    = e;
+                d2[0][0] = - two * x * e;
+                if( op == ErfcOp )
+                {   d1[0]    = - d1[0];
+                    d2[0][0] = - d2[0][0];
+                }
+            }
+            break;
+
+            case ExpOp:
+            d1[0]    = z;
+            d2[0][0] = z;
+            break;
+
+            case Expm1Op:
+            d1[0]    = z + one;
+            d2[0][0] = z + one;
+            break;
+
+            case LogOp:
+            d1[0]    = one / x;
+            d2[0][0] = - one / (x * x);
+            break;
+
+            case Log1pOp:
+            d1[0]    = one / (one + x);
+            d2[0][0] = - one / ( (one + x) * (one + x) );
+            break;
+
+            case NegOp:
+            d1[0]     = - one;
+            nonlinear = false;
+            break;
+
+            case SignOp:
+            nonlinear = false;
+            break;
+
+            case SinOp:
+            // aux = cos(x)
+            d1[0]    = aux;
+            d2[0][0] = - z;
+            break;
+
+            case SinhOp:
+            // aux = cosh(x)
+            d1[0]    = aux;
+            d2[0][0] = z;
+            break;
+
+            case SqrtOp:
+            d1[0]    = one / (two * z);
+            d2[0][0] = - one / (two * two * z * z * z);
+            break;
+
+            case TanOp:
+            // aux = tan(x) * tan(x)
+            d1[0]    = one + aux;
+            d2[0][0] = two * z * (one + aux);
+            break;
+
+            case TanhOp:
+            // aux = tanh(x) * tanh(x)
+            d1[0]    = one - aux;
+            d2[0][0] = - two * z * (one - aux);
+            break;
+
+            // ---------------------------------------------------------------
+            // binary operators
+            case AddvvOp:
+            arg_var.push_back( size_t(arg[0]) );
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(one);
+            d1.push_back(one);
+            break;
+
+            case AddpvOp:
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(one);
+            break;
+
+            case SubvvOp:
+            arg_var.push_back( size_t(arg[0]) );
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(one);
+            d1.push_back(- one);
+            break;
+
+            case SubpvOp:
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(- one);
+            break;
+
+            case SubvpOp:
+            arg_var.push_back( size_t(arg[0]) );
+            d1.push_back(one);
+            break;
+
+            case MulvvOp:
+            x = taylor[ size_t(arg[0]) * J ];
+            y = taylor[ size_t(arg[1]) * J ];
+            arg_var.push_back( size_t(arg[0]) );
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(y);
+            d1.push_back(x);
+            nonlinear = true;
+            d2[0][0]  = zero;
+            d2[0][1]  = one;
+            d2[1][0]  = one;
+            d2[1][1]  = zero;
+            break;
+
+            case MulpvOp:
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back( parameter[ arg[0] ] );
+            break;
+
+            case DivvvOp:
+            y = taylor[ size_t(arg[1]) * J ];
+            arg_var.push_back( size_t(arg[0]) );
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(one / y);
+            d1.push_back(- z / y);
+            nonlinear = true;
+            d2[0][0]  = zero;
+            d2[0][1]  = - one / (y * y);
+            d2[1][0]  = d2[0][1];
+            d2[1][1]  = two * z / (y * y);
+            break;
+
+            case DivpvOp:
+            y = taylor[ size_t(arg[1]) * J ];
+            arg_var.push_back( size_t(arg[1]) );
+            d1.push_back(- z / y);
+            nonlinear = true;
+            d2[0][0]  = two * z / (y * y);
+            break;
+
+            case DivvpOp:
+            arg_var.push_back( size_t(arg[0]) );
+            d1.push_back( one / parameter[ arg[1] ] );
+            break;
+
+            case PowvpOp:
+            {   // z = x^p
+                x      = taylor[ size_t(arg[0]) * J ];
+                Base p = parameter[ arg[1] ];
+                arg_var.push_back( size_t(arg[0]) );
+                d1.push_back( p * pow(x, p - one) );
+                nonlinear = true;
+                d2[0][0]  = p * (p - one) * pow(x, p - two);
+            }
+            break;
+
+            case PowpvOp:
+            {   // z = p^y, the first result is log(p)
+                Base log_p = taylor[ (i_var - 2) * J ];
+                arg_var.push_back( size_t(arg[1]) );
+                d1.push_back( log_p * z );
+                nonlinear = true;
+                d2[0][0]  = log_p * log_p * z;
+            }
+            break;
+
+            case PowvvOp:
+            {   // z = x^y, the first result is log(x)
+                Base log_x = taylor[ (i_var - 2) * J ];
+                x = taylor[ size_t(arg[0]) * J ];
+                y = taylor[ size_t(arg[1]) * J ];
+                arg_var.push_back( size_t(arg[0]) );
+                arg_var.push_back( size_t(arg[1]) );
+                d1.push_back( y * z / x );
+                d1.push_back( log_x * z );
+                nonlinear = true;
+                d2[0][0]  = y * (y - one) * z / (x * x);
+                d2[0][1]  = z * (one + y * log_x) / x;
+                d2[1][0]  = d2[0][1];
+                d2[1][1]  = log_x * log_x * z;
+            }
+            break;
+
+            // ---------------------------------------------------------------
+            // other operators
+            case CExpOp:
+            {   Base left, right;
+                if( arg[1] & 1 )
+                    left = taylor[ size_t(arg[2]) * J ];
+                else
+                    left = parameter[ arg[2] ];
+                if( arg[1] & 2 )
+                    right = taylor[ size_t(arg[3]) * J ];
+                else
+                    right = parameter[ arg[3] ];
+                CompareOp cop = CompareOp( arg[0] );
+                if( arg[1] & 4 )
+                {   arg_var.push_back( size_t(arg[4]) );
+                    d1.push_back( CondExpOp(cop, left, right, one, zero) );
+                }
+                if( arg[1] & 8 )
+                {   arg_var.push_back( size_t(arg[5]) );
+                    d1.push_back( CondExpOp(cop, left, right, zero, one) );
+                }
+            }
+            break;
+
+            case CSumOp:
+            for(addr_t i = 5; i < arg[1]; ++i)
+            {   arg_var.push_back( size_t(arg[i]) );
+                d1.push_back(one);
+            }
+            for(addr_t i = arg[1]; i < arg[2]; ++i)
+            {   arg_var.push_back( size_t(arg[i]) );
+                d1.push_back(- one);
+            }
+            break;
+
+            case DisOp:
+            case ParOp:
+            // the derivative of the result is zero
+            arg_var.resize(0);
+            d1.resize(0);
+            nonlinear = false;
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+            break;
+        }
+        size_t n_arg = arg_var.size();
+        CPPAD_ASSERT_UNKNOWN( d1.size() == n_arg );
+        CPPAD_ASSERT_UNKNOWN( ! nonlinear || n_arg <= 2 );
+        //
+        // W_ii
+        Base W_ii = zero;
+        typename std::map<size_t, Base>::iterator itr = W[i_var].find(i_var);
+        if( itr != W[i_var].end() )
+            W_ii = itr->second;
+        //
+        // pushing: W(i, p) for p != i
+        for(itr = W[i_var].begin(); itr != W[i_var].end(); ++itr)
+        {   size_t p = itr->first;
+            if( p != i_var )
+            {   CPPAD_ASSERT_UNKNOWN( p < i_var );
+                for(size_t k = 0; k < n_arg; ++k)
+                {   Base value = d1[k] * itr->second;
+                    edge_push_add(W, arg_var[k], p, value);
+                    edge_push_add(W, p, arg_var[k], value);
+                }
+                // remove W(p, i)
+                W[p].erase(i_var);
+            }
+        }
+        //
+        // pushing: W(i, i)
+        if( ! IdenticalZero(W_ii) )
+        {   for(size_t k = 0; k < n_arg; ++k)
+            {   for(size_t ell = 0; ell < n_arg; ++ell)
+                {   Base value = d1[k] * d1[ell] * W_ii;
+                    edge_push_add(W, arg_var[k], arg_var[ell], value);
+                }
+            }
+        }
+        //
+        // creating: adjoint(i) times second partials of this operator
+        Base adjoint_i = adjoint[i_var];
+        if( nonlinear && ! IdenticalZero(adjoint_i) )
+        {   for(size_t k = 0; k < n_arg; ++k)
+            {   for(size_t ell = 0; ell < n_arg; ++ell)
+                {   Base value = adjoint_i * d2[k][ell];
+                    edge_push_add(W, arg_var[k], arg_var[ell], value);
+                }
+            }
+        }
+        //
+        // adjoint
+        for(size_t k = 0; k < n_arg; ++k)
+            adjoint[ arg_var[k] ] += d1[k] * adjoint_i;
+        //
+        // remove row i from W
+        W[i_var].clear();
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
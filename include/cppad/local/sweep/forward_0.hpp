@@ -2,13 +2,15 @@
 # define CPPAD_LOCAL_SWEEP_FORWARD_0_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
 # include <cppad/local/sweep/call_atomic.hpp>
 # include <cppad/local/var_op/compare_op.hpp>
 # include <cppad/local/var_op/atomic_op.hpp>
+# include <cppad/local/sweep/atomic_batch.hpp>
+# include <cppad/local/sweep/profile.hpp>
 
 # define CPPAD_FORWARD_0_TRACE 0
 
@@ -19,6 +21,7 @@ namespace CppAD { namespace local { namespace sweep {
 {xrst_begin sweep_forward_0 dev}
 {xrst_spell
     cskip
+    prof
 }
 
 {xrst_template ;
@@ -39,6 +42,35 @@ namespace CppAD { namespace local { namespace sweep {
     @****@  ; *********
 }
 
+atomic_parallel
+***************
+If this is not null, it is the :ref:`atomic_parallel@par_for` function.
+In this case, independent atomic function calls are evaluated in batches;
+see :ref:`sweep_atomic_batch-name` .
+In this case, the time for evaluating a batch is included in the time
+for the operator that first uses one of its results.
+
+prof
+****
+If this is not null, the count and time for each operator is added to
+the ``forward_0_enum`` sweep in *prof* ;
+see :ref:`sweep_profile_class-name` .
+
+subset
+******
+If this is null, all the operators are evaluated.
+Otherwise, only a subset of the operators is evaluated,
+the other Taylor coefficients are not changed,
+and the conditional skip flags *cskip_op* are not initialized
+(their values from the previous zero order sweep are used).
+For each operator in the subset there are three elements of *subset* ;
+the operator index, the index of its first argument in the vector of
+arguments for all the operators, and the primary variable index for
+the operator (as returned by a sequential iterator).
+The operator indices are increasing and the last operator is ``EndOp`` .
+If an atomic function call is in the subset, only its first ``AFunOp``
+operator is included.
+
 {xrst_end sweep_forward_0}
 */
 
@@ -56,7 +88,10 @@ void forward_0(
     size_t&                    change_op_index,
     std::ostream&              s_out,
     bool                       print,
-    Base*                      taylor
+    Base*                      taylor,
+    atomic_parallel_for        atomic_parallel,
+    profile*                   prof,
+    const pod_vector<size_t>*  subset
 )
 // END_FORWARD_0
 {   CPPAD_ASSERT_UNKNOWN( cap_order >= 1 );
@@ -90,9 +125,12 @@ void forward_0(
             }
         }
         // includes zero order, so initialize conditional skip flags
+        // (a subset sweep uses the flags from the previous sweep)
         num = play->num_var_op();
-        for(i = 0; i < num; i++)
-            cskip_op[i] = false;
+        if( subset == nullptr )
+        {   for(i = 0; i < num; i++)
+                cskip_op[i] = false;
+        }
     }
 
     // information used by atomic function operators
@@ -100,6 +138,12 @@ void forward_0(
     // work space used by atomic functions
     var_op::atomic_op_work<Base> atom_work;
 
+    // batch of independent atomic function calls (if use_batch)
+    bool use_batch = atomic_parallel != nullptr;
+    atomic_batch<Base, RecBase> batch(
+        atomic_parallel, num_var, cap_order, taylor
+    );
+
     // length of the parameter vector (used by CppAD assert macros)
     const size_t num_par = play->num_par_all();
 
@@ -107,6 +151,9 @@ void forward_0(
     CPPAD_ASSERT_UNKNOWN( num_par > 0 )
     const Base* parameter = play->par_ptr();
 
+    // runs of contiguous operators that a CSkipOp can skip
+    const play::skip_run_t& skip_run = play->skip_run();
+
     // length of the text vector (used by CppAD assert macros)
     const size_t num_text = play->num_var_text();
 
@@ -134,16 +181,45 @@ void forward_0(
 # if CPPAD_FORWARD_0_TRACE
     std::cout << std::endl;
 # endif
+    // index in subset of the next operator
+    size_t i_subset = 0;
+    //
     bool more_operators = true;
     while(more_operators)
     {
-        // next op
-        (++itr).op_info(op, arg, i_var);
+        // next op that is not skipped
+        if( subset != nullptr )
+        {   do
+            {   CPPAD_ASSERT_UNKNOWN( 3 * i_subset + 2 < subset->size() );
+                itr.jump(
+                    (*subset)[3 * i_subset + 0],
+                    (*subset)[3 * i_subset + 1],
+                    (*subset)[3 * i_subset + 2]
+                );
+                ++i_subset;
+            }
+            while( cskip_op[itr.op_index()] );
+            itr.op_info(op, arg, i_var);
+        }
+        else
+            (++itr).op_info(op, arg, i_var);
         CPPAD_ASSERT_UNKNOWN( itr.op_index() < play->num_var_op() );
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
+        {   // jump to the last operator in a run that is skipped
+            const addr_t* run = skip_run.first( itr.op_index() );
+            if( var_op::cskip_run_valid(
+                run, i_var, num_par, parameter, cap_order, taylor, cskip_op
+            ) )
+            {   itr.jump(
+                    size_t( run[play::skip_run_t::last_op_field] )  ,
+                    size_t( run[play::skip_run_t::last_arg_field] ) ,
+                    size_t( run[play::skip_run_t::last_var_field] )
+                );
+                itr.op_info(op, arg, i_var);
+            }
+            switch(op)
             {
                 case AFunOp:
                 {   // get information for this atomic function call
@@ -173,6 +249,14 @@ void forward_0(
             (++itr).op_info(op, arg, i_var);
         }
 
+        // start timing this operator
+        if( prof != nullptr )
+            prof->start();
+
+        // evaluate pending atomic function calls that this operator uses
+        if( use_batch && op != AFunOp )
+            batch.check(op, arg);
+
         // action to take depends on the case
         switch( op )
         {
@@ -320,6 +404,8 @@ void forward_0(
 
             case EndOp:
             CPPAD_ASSERT_NARG_NRES(op, 0, 0);
+            if( use_batch )
+                batch.flush();
             more_operators = false;
             break;
             // -------------------------------------------------
@@ -499,6 +585,10 @@ void forward_0(
 
             case AFunOp:
             // start of an atomic function call
+            if( use_batch )
+            {   batch.add(itr, play, parameter);
+                break;
+            }
             var_op::atomic_forward_any<Base, RecBase>(
                 itr,
                 play,
@@ -540,6 +630,8 @@ void forward_0(
             default:
             CPPAD_ASSERT_UNKNOWN(false);
         }
+        if( prof != nullptr )
+            prof->stop(profile::forward_0_enum, op, arg);
 # if CPPAD_FORWARD_0_TRACE
         size_t  d  = 0;
         Base*           Z_tmp   = taylor + i_var * cap_order;
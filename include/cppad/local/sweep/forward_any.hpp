@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_FORWARD_ANY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -10,6 +10,8 @@
 # include <cppad/local/var_op/compare_op.hpp>
 # include <cppad/local/var_op/atomic_op.hpp>
 
+# include <cppad/local/sweep/profile.hpp>
+
 # define CPPAD_FORWARD_ANY_TRACE 0
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
@@ -19,6 +21,7 @@ namespace CppAD { namespace local { namespace sweep {
 {xrst_begin sweep_forward_any dev}
 {xrst_spell
     cskip
+    prof
 }
 
 {xrst_template ;
@@ -40,6 +43,12 @@ namespace CppAD { namespace local { namespace sweep {
     @****@  ; ***********
 }
 
+prof
+****
+If this is not null, the count and time for each operator is added to
+the ``forward_any_enum`` sweep in *prof* ;
+see :ref:`sweep_profile_class-name` .
+
 {xrst_end sweep_forward_any}
 */
 // BEGIN_FORWARD_ANY
@@ -58,7 +67,8 @@ void forward_any(
     const bool                 print,
     const size_t               order_low,
     const size_t               order_up,
-    Base*                      taylor
+    Base*                      taylor,
+    profile*                   prof
 )
 // END_FORWARD_ANY
 {
@@ -183,6 +193,10 @@ void forward_any(
             (++itr).op_info(op, arg, i_var);
         }
 
+        // start timing this operator
+        if( prof != nullptr )
+            prof->start();
+
         // action depends on the operator
         switch( op )
         {
@@ -650,6 +664,8 @@ void forward_any(
             default:
             CPPAD_ASSERT_UNKNOWN(false);
         }
+        if( prof != nullptr )
+            prof->stop(profile::forward_any_enum, op, arg);
 # if CPPAD_FORWARD_ANY_TRACE
         Base*           Z_tmp   = taylor + cap_order * i_var;
         if( op != AFunOp )
@@ -0,0 +1,223 @@
+# ifndef CPPAD_LOCAL_SWEEP_PROFILE_HPP
+# define CPPAD_LOCAL_SWEEP_PROFILE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <chrono>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/op_code_var.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*
+------------------------------------------------------------------------------
+{xrst_begin sweep_profile_class dev}
+{xrst_spell
+    prof
+}
+
+Count and Time the Operators During a Sweep
+###########################################
+
+Syntax
+******
+| ``profile`` *prof*
+| *prof* . ``clear`` ()
+| *prof* . ``start`` ()
+| *prof* . ``stop`` ( *sweep* , *op* , *arg* )
+| *prof* . ``swap`` ( *other* )
+| *count* = *prof* . ``op_count`` ( *sweep* , *op* )
+| *seconds* = *prof* . ``op_seconds`` ( *sweep* , *op* )
+| *n_atom* = *prof* . ``n_atom`` ( *sweep* )
+| *count* = *prof* . ``atom_count`` ( *sweep* , *atom_index* )
+| *seconds* = *prof* . ``atom_seconds`` ( *sweep* , *atom_index* )
+
+Purpose
+*******
+This is used by the :ref:`sweep_forward_0-name` ,
+:ref:`sweep_forward_any-name` and ``sweep::reverse`` routines
+to implement :ref:`sweep_profile-name` .
+A sweep that is passed a null profile pointer does not do any profiling.
+
+sweep
+*****
+This has type ``profile::sweep_enum`` and is one of the following:
+``forward_0_enum`` , ``forward_any_enum`` , ``reverse_enum`` .
+The value ``number_sweep_enum`` is the number of sweeps (not a sweep).
+
+clear
+*****
+Sets all the counts and times to zero.
+This frees the memory used by *prof* ;
+e.g., the memory used by an ``ADFun`` object that is not being profiled.
+Memory is only allocated when ``stop`` is called.
+
+start
+*****
+Records the time at which the current operator starts.
+
+stop
+****
+Adds the time since the previous call to ``start``
+to the time for operator *op* during the specified sweep
+and adds one to its count.
+If *op* is an ``AFunOp`` , the atomic function call
+(that starts or ends with this operator) is evaluated during the time,
+*arg* [0] is the corresponding atomic function index
+and the count and time are for this atomic function
+(not the ``AFunOp`` operator).
+
+swap
+****
+Exchanges the contents of *prof* and *other* .
+
+op_count, op_seconds
+********************
+Is the number of times, and total seconds, for operator *op*
+during the specified sweep.
+
+n_atom
+******
+Is one greater than the maximum atomic function index for which
+there is a count or time during the specified sweep.
+
+atom_count, atom_seconds
+************************
+Is the number of calls, and total seconds, for the atomic function with
+index *atom_index* during the specified sweep
+(*atom_index* must be less than *n_atom* ).
+
+{xrst_end sweep_profile_class}
+*/
+class profile {
+public:
+    // sweep_enum
+    enum sweep_enum {
+        forward_0_enum,
+        forward_any_enum,
+        reverse_enum,
+        number_sweep_enum
+    };
+private:
+    // clock
+    typedef std::chrono::steady_clock clock;
+    //
+    // start_
+    clock::time_point start_;
+    //
+    // op_count_[ sweep * NumberOp + op ], op_seconds_[ sweep * NumberOp + op ]
+    // (empty when all of the counts are zero)
+    pod_vector<size_t> op_count_;
+    pod_vector<double> op_seconds_;
+    //
+    // atom_count_[sweep][atom_index], atom_seconds_[sweep][atom_index]
+    pod_vector<size_t> atom_count_[number_sweep_enum];
+    pod_vector<double> atom_seconds_[number_sweep_enum];
+public:
+    // ctor
+    profile(void)
+    { }
+    //
+    // clear
+    void clear(void)
+    {   op_count_.clear();
+        op_seconds_.clear();
+        for(size_t sweep = 0; sweep < number_sweep_enum; ++sweep)
+        {   atom_count_[sweep].clear();
+            atom_seconds_[sweep].clear();
+        }
+    }
+    //
+    // start
+    void start(void)
+    {   start_ = clock::now(); }
+    //
+    // stop
+    void stop(sweep_enum sweep, op_code_var op, const addr_t* arg)
+    {   double seconds =
+            std::chrono::duration<double>( clock::now() - start_ ).count();
+        if( op != AFunOp )
+        {   if( op_count_.size() == 0 )
+            {   size_t n_index = size_t(number_sweep_enum) * size_t(NumberOp);
+                op_count_.resize(n_index);
+                op_seconds_.resize(n_index);
+                for(size_t i = 0; i < n_index; ++i)
+                {   op_count_[i]   = 0;
+                    op_seconds_[i] = 0.0;
+                }
+            }
+            size_t index = size_t(sweep) * size_t(NumberOp) + size_t(op);
+            ++op_count_[index];
+            op_seconds_[index] += seconds;
+            return;
+        }
+        pod_vector<size_t>& count( atom_count_[sweep] );
+        pod_vector<double>& total( atom_seconds_[sweep] );
+        size_t atom_index = size_t( arg[0] );
+        if( count.size() <= atom_index )
+        {   size_t old_size = count.extend( atom_index + 1 - count.size() );
+            total.extend( atom_index + 1 - total.size() );
+            for(size_t i = old_size; i <= atom_index; ++i)
+            {   count[i] = 0;
+                total[i] = 0.0;
+            }
+        }
+        ++count[atom_index];
+        total[atom_index] += seconds;
+    }
+    //
+    // swap
+    void swap(profile& other)
+    {   std::swap(start_, other.start_);
+        op_count_.swap( other.op_count_ );
+        op_seconds_.swap( other.op_seconds_ );
+        for(size_t sweep = 0; sweep < number_sweep_enum; ++sweep)
+        {   atom_count_[sweep].swap( other.atom_count_[sweep] );
+            atom_seconds_[sweep].swap( other.atom_seconds_[sweep] );
+        }
+    }
+    //
+    // memory
+    // number of bytes allocated for the counts and times
+    size_t memory(void) const
+    {   size_t bytes = op_count_.capacity() * sizeof(size_t);
+        bytes       += op_seconds_.capacity() * sizeof(double);
+        for(size_t sweep = 0; sweep < number_sweep_enum; ++sweep)
+        {   bytes += atom_count_[sweep].capacity() * sizeof(size_t);
+            bytes += atom_seconds_[sweep].capacity() * sizeof(double);
+        }
+        return bytes;
+    }
+    //
+    // op_count
+    size_t op_count(sweep_enum sweep, op_code_var op) const
+    {   if( op_count_.size() == 0 )
+            return 0;
+        return op_count_[ size_t(sweep) * size_t(NumberOp) + size_t(op) ];
+    }
+    //
+    // op_seconds
+    double op_seconds(sweep_enum sweep, op_code_var op) const
+    {   if( op_seconds_.size() == 0 )
+            return 0.0;
+        return op_seconds_[ size_t(sweep) * size_t(NumberOp) + size_t(op) ];
+    }
+    //
+    // n_atom
+    size_t n_atom(sweep_enum sweep) const
+    {   return atom_count_[sweep].size(); }
+    //
+    // atom_count
+    size_t atom_count(sweep_enum sweep, size_t atom_index) const
+    {   return atom_count_[sweep][atom_index]; }
+    //
+    // atom_seconds
+    double atom_seconds(sweep_enum sweep, size_t atom_index) const
+    {   return atom_seconds_[sweep][atom_index]; }
+};
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -2,11 +2,12 @@
 # define CPPAD_LOCAL_SWEEP_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 
 # include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/sweep/profile.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -81,6 +82,17 @@ with respect to all the Taylor coefficients
 Is the number of columns in the coefficient matrix Taylor.
 This must be greater than or equal d + 1.
 
+\param taylor_all
+For ell = 0 , ... , n_dir - 1,
+the matrix Taylor for direction ell is
+<code>Taylor = taylor_all + ell * taylor_stride</code>
+(the specifications below are for each direction).
+
+\param taylor_stride
+is the offset in taylor_all between the Taylor coefficients for
+one direction and the next.
+If it is zero, all the directions use the same Taylor coefficients.
+
 \param Taylor
 For i = 1 , ... , num_var, and for k = 0 , ... , d,
  Taylor [ i * J + k ]
@@ -96,6 +108,18 @@ for j = 1 , ... , n, and for k = 0 , ... , d.
 Is the number of columns in the partial derivative matrix Partial.
 It must be greater than or equal d + 1.
 
+\param n_dir
+is the number of directions; i.e., the number of different
+matrices \f$ w \f$, and possibly different values \f$ u \f$,
+that we are computing the derivative for.
+The operation sequence is only read once for all the directions.
+
+\param partial_all
+For ell = 0 , ... , n_dir - 1,
+the matrix Partial for direction ell is
+<code>Partial = partial_all + ell * num_var * K</code>
+(the specifications below are for each direction).
+
 \param Partial
 \b Input:
 The last \f$ m \f$ rows of Partial are inputs.
@@ -152,6 +176,10 @@ the entire atomic function call must be in the subgraph.
 \param not_used_rec_base
 Specifies RecBase for this call.
 
+\param prof
+If this is not null, the count and time for each operator is added to
+the reverse_enum sweep in prof.
+
 \par Assumptions
 The first operator on the tape is a BeginOp,
 and the next n operators are InvOp operations for the
@@ -162,13 +190,16 @@ void reverse(
     size_t                      num_var,
     const local::player<Base>*  play,
     size_t                      cap_order,
-    const Base*                 Taylor,
+    const Base*                 taylor_all,
+    size_t                      taylor_stride,
     size_t                      K,
-    Base*                       Partial,
+    size_t                      n_dir,
+    Base*                       partial_all,
     bool*                       cskip_op,
     const pod_vector<addr_t>&   load_op2var,
     Iterator&                   play_itr,
-    const RecBase&              not_used_rec_base
+    const RecBase&              not_used_rec_base,
+    profile*                    prof
 )
 {
     // check num_var argument
@@ -182,6 +213,9 @@ void reverse(
     CPPAD_ASSERT_UNKNOWN( num_par > 0 )
     const Base* parameter = play->par_ptr();
 
+    // runs of contiguous operators that a CSkipOp can skip
+    const play::skip_run_t& skip_run = play->skip_run();
+
     // work space used by atomic functions
     var_op::atomic_op_work<Base> atom_work;
 
@@ -213,7 +247,15 @@ void reverse(
         // check if we are skipping this operation
         size_t i_op = play_itr.op_index();
         while( cskip_op[i_op] )
-        {   switch(op)
+        {   // jump to the first operator in a run that is skipped
+            const addr_t* run = play::skip_run_last(skip_run, play_itr);
+            if( var_op::cskip_run_valid(
+                run, i_var, num_par, parameter, cap_order, taylor_all, cskip_op
+            ) )
+            {   play::skip_run_jump_first(play_itr, run);
+                play_itr.op_info(op, arg, i_var);
+            }
+            switch(op)
             {
                 case CSumOp:
                 case CSkipOp:
@@ -245,8 +287,8 @@ void reverse(
         if( op != AFunOp )
         {
             size_t       i_tmp  = i_var;
-            const Base*  Z_tmp  = Taylor + i_var * cap_order;
-            const Base*  pZ_tmp = Partial + i_var * K;
+            const Base*  Z_tmp  = taylor_all + i_var * cap_order;
+            const Base*  pZ_tmp = partial_all + i_var * K;
             printOp<Base, RecBase>(
                 std::cout,
                 play,
@@ -265,424 +307,446 @@ void reverse(
             std::cout << std::endl;
         }
 # endif
-        switch( op )
-        {
-            case AbsOp:
-            var_op::abs_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case AcosOp:
-            // sqrt(1 - x * x), acos(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::acos_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case AcoshOp:
-            // sqrt(x * x - 1), acosh(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::acosh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+        // start timing this operator
+        if( prof != nullptr )
+            prof->start();
 
-            case AddvvOp:
-            var_op::addvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+        // CSkipOp and CSumOp have a variable number of arguments
+        if( op == CSkipOp || op == CSumOp )
+            play_itr.correct_after_decrement(arg);
+        //
+        // atom_itr
+        Iterator atom_itr;
+        if( op == AFunOp )
+            atom_itr = play_itr;
+        //
+        for(size_t ell = 0; ell < n_dir; ++ell)
+        {   // Partial
+            const Base* Taylor  = taylor_all + ell * taylor_stride;
+            Base*       Partial = partial_all + ell * num_var * K;
+            //
+            switch( op )
+            {
+                case AbsOp:
+                var_op::abs_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AcosOp:
+                // sqrt(1 - x * x), acos(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::acos_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AcoshOp:
+                // sqrt(x * x - 1), acosh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::acosh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case AddpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::addpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case AsinOp:
-            // sqrt(1 - x * x), asin(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::asin_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case AsinhOp:
-            // sqrt(1 + x * x), asinh(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::asinh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case AtanOp:
-            // 1 + x * x, atan(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::atan_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
-
-            case AtanhOp:
-            // 1 - x * x, atanh(x)
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::atanh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case AddvvOp:
+                var_op::addvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case BeginOp:
-            CPPAD_ASSERT_NARG_NRES(op, 1, 1);
-            CPPAD_ASSERT_UNKNOWN( i_op == 0 );
-            break;
-            // --------------------------------------------------
+                case AddpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::addpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AsinOp:
+                // sqrt(1 - x * x), asin(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::asin_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AsinhOp:
+                // sqrt(1 + x * x), asinh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::asinh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AtanOp:
+                // 1 + x * x, atan(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::atan_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case AtanhOp:
+                // 1 - x * x, atanh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::atanh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            case CSkipOp:
-            // CSkipOp has a zero order forward action.
-            play_itr.correct_after_decrement(arg);
-            break;
-            // -------------------------------------------------
+                case BeginOp:
+                CPPAD_ASSERT_NARG_NRES(op, 1, 1);
+                CPPAD_ASSERT_UNKNOWN( i_op == 0 );
+                break;
+                // --------------------------------------------------
 
-            case CSumOp:
-            play_itr.correct_after_decrement(arg);
-            var_op::csum_reverse(
-                i_var, arg, K, Partial
-            );
-            // end of a cumulative summation
-            break;
-            // -------------------------------------------------
-
-            case CExpOp:
-            var_op::cexp_reverse(
-                i_var,
-                arg,
-                num_par,
-                parameter,
-                cap_order,
-                Taylor,
-                K,
-                Partial
-            );
-            break;
-            // --------------------------------------------------
+                case CSkipOp:
+                // CSkipOp has a zero order forward action.
+                break;
+                // -------------------------------------------------
 
-            case CosOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::cos_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case CSumOp:
+                var_op::csum_reverse(
+                    i_var, arg, K, Partial
+                );
+                // end of a cumulative summation
+                break;
+                // -------------------------------------------------
+
+                case CExpOp:
+                var_op::cexp_reverse(
+                    i_var,
+                    arg,
+                    num_par,
+                    parameter,
+                    cap_order,
+                    Taylor,
+                    K,
+                    Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case CoshOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::cosh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case DisOp:
-            // Derivative of discrete operation is zero so no
-            // contribution passes through this operation.
-            break;
-            // --------------------------------------------------
-
-            case DivvvOp:
-            var_op::divvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case CosOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::cos_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case DivpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::divpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case CoshOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::cosh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case DivvpOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            var_op::divvp_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-            case EndOp:
-            CPPAD_ASSERT_UNKNOWN(
-                i_op == play->num_var_op() - 1
-            );
-            break;
+                case DisOp:
+                // Derivative of discrete operation is zero so no
+                // contribution passes through this operation.
+                break;
+                // --------------------------------------------------
 
-            // --------------------------------------------------
+                case DivvvOp:
+                var_op::divvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case ErfOp:
-            case ErfcOp:
-            var_op::erf_reverse(
-                op, i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case DivpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::divpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case ExpOp:
-            var_op::exp_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case DivvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                var_op::divvp_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+                case EndOp:
+                CPPAD_ASSERT_UNKNOWN(
+                    i_op == play->num_var_op() - 1
+                );
+                break;
 
-            case Expm1Op:
-            var_op::expm1_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                // --------------------------------------------------
 
-            case InvOp:
-            break;
-            // --------------------------------------------------
+                case ErfOp:
+                case ErfcOp:
+                var_op::erf_reverse(
+                    op, i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case LdpOp:
-            case LdvOp:
-            var_op::load_reverse(
-                op, i_var, arg, load_op2var, cap_order, K, Partial
-            );
-            break;
-            // -------------------------------------------------
-
-            case EqppOp:
-            case EqpvOp:
-            case EqvvOp:
-            case LtppOp:
-            case LtpvOp:
-            case LtvpOp:
-            case LtvvOp:
-            case LeppOp:
-            case LepvOp:
-            case LevpOp:
-            case LevvOp:
-            case NeppOp:
-            case NepvOp:
-            case NevvOp:
-            break;
-            // -------------------------------------------------
-
-            case LogOp:
-            var_op::log_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case ExpOp:
+                var_op::exp_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case Log1pOp:
-            var_op::log1p_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case Expm1Op:
+                var_op::expm1_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case MulpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::mulpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case InvOp:
+                break;
+                // --------------------------------------------------
 
-            case MulvvOp:
-            var_op::mulvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case LdpOp:
+                case LdvOp:
+                var_op::load_reverse(
+                    op, i_var, arg, load_op2var, cap_order, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case EqppOp:
+                case EqpvOp:
+                case EqvvOp:
+                case LtppOp:
+                case LtpvOp:
+                case LtvpOp:
+                case LtvvOp:
+                case LeppOp:
+                case LepvOp:
+                case LevpOp:
+                case LevvOp:
+                case NeppOp:
+                case NepvOp:
+                case NevvOp:
+                break;
+                // -------------------------------------------------
 
-            case NegOp:
-            var_op::neg_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case LogOp:
+                var_op::log_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case ParOp:
-            break;
-            // --------------------------------------------------
+                case Log1pOp:
+                var_op::log1p_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case PowvpOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            var_op::powvp_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial, work
-            );
-            break;
-            // -------------------------------------------------
+                case MulpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::mulpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case PowpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::powpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case MulvvOp:
+                var_op::mulvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            case PowvvOp:
-            var_op::powvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
-
-            case PriOp:
-            // no result so nothing to do
-            break;
-            // --------------------------------------------------
-
-            case SignOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::sign_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case NegOp:
+                var_op::neg_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case SinOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::sin_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case ParOp:
+                break;
+                // --------------------------------------------------
 
-            case SinhOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::sinh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case PowvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                var_op::powvp_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial, work
+                );
+                break;
+                // -------------------------------------------------
 
-            case SqrtOp:
-            var_op::sqrt_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case PowpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::powpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            case StppOp:
-            break;
-            // --------------------------------------------------
+                case PowvvOp:
+                var_op::powvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case StpvOp:
-            break;
-            // -------------------------------------------------
+                case PriOp:
+                // no result so nothing to do
+                break;
+                // --------------------------------------------------
 
-            case StvpOp:
-            break;
-            // -------------------------------------------------
+                case SignOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::sign_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            case StvvOp:
-            break;
-            // --------------------------------------------------
+                case SinOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::sin_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            case SubvvOp:
-            var_op::subvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case SinhOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::sinh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case SubpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::subpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case SqrtOp:
+                var_op::sqrt_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case SubvpOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            var_op::subvp_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case StppOp:
+                break;
+                // --------------------------------------------------
 
-            case TanOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::tan_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // -------------------------------------------------
+                case StpvOp:
+                break;
+                // -------------------------------------------------
 
-            case TanhOp:
-            CPPAD_ASSERT_UNKNOWN( i_var < num_var );
-            var_op::tanh_reverse(
-                i_var, arg, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case StvpOp:
+                break;
+                // -------------------------------------------------
 
-            case AFunOp:
-            var_op::atomic_reverse<Base, RecBase, Iterator>(
-                play_itr,
-                play,
-                parameter,
-                atom_trace,
-                atom_work,
-                cap_order,
-                K,
-                Taylor,
-                Partial
-            );
-            break;
-
-            case FunapOp:
-            case FunavOp:
-            case FunrpOp:
-            case FunrvOp:
-            CPPAD_ASSERT_UNKNOWN(false);
-            break;
-            // ------------------------------------------------------------
-
-            case ZmulpvOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            var_op::zmulpv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case StvvOp:
+                break;
+                // --------------------------------------------------
 
-            case ZmulvpOp:
-            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            var_op::zmulvp_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case SubvvOp:
+                var_op::subvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
 
-            case ZmulvvOp:
-            var_op::zmulvv_reverse(
-                i_var, arg, parameter, cap_order, Taylor, K, Partial
-            );
-            break;
-            // --------------------------------------------------
+                case SubpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::subpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case SubvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                var_op::subvp_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case TanOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::tan_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
 
-            default:
-            CPPAD_ASSERT_UNKNOWN(false);
+                case TanhOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < num_var );
+                var_op::tanh_reverse(
+                    i_var, arg, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AFunOp:
+                // each direction starts at the last AFunOp for this call
+                if( ell > 0 )
+                    play_itr = atom_itr;
+                var_op::atomic_reverse<Base, RecBase, Iterator>(
+                    play_itr,
+                    play,
+                    parameter,
+                    atom_trace,
+                    atom_work,
+                    cap_order,
+                    K,
+                    Taylor,
+                    Partial
+                );
+                break;
+
+                case FunapOp:
+                case FunavOp:
+                case FunrpOp:
+                case FunrvOp:
+                CPPAD_ASSERT_UNKNOWN(false);
+                break;
+                // ------------------------------------------------------------
+
+                case ZmulpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                var_op::zmulpv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ZmulvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                var_op::zmulvp_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ZmulvvOp:
+                var_op::zmulvv_reverse(
+                    i_var, arg, parameter, cap_order, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                default:
+                CPPAD_ASSERT_UNKNOWN(false);
+            }
         }
+        if( prof != nullptr )
+            prof->stop(profile::reverse_enum, op, arg);
     }
 # if CPPAD_REVERSE_TRACE
     std::cout << std::endl;
@@ -2,7 +2,7 @@
 # define  CPPAD_LOCAL_VAL_GRAPH_FUN2VAL_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // --------------------------------------------------------------------------
 /*
 ------------------------------------------------------------------------------
@@ -207,6 +207,22 @@ void ADFun<Base, RecBase>::fun2val(
 # else
     val_tape.set_ind( n_val_ind );
 # endif
+    //
+    // val_tape
+    // Reserve memory using upper bounds for the size of the recording.
+    // Each parameter and VecAD initial value is at most one constant,
+    // each dynamic parameter operator is at most one value operator, and
+    // each variable operator is at most one value operator with at most
+    // one more argument than in play_.
+    {   size_t n_con = n_parameter + play_.num_var_vec_ind();
+        size_t n_vec = play_.num_var_vecad();
+        size_t n_op  = 1 + n_con + n_vec;
+        n_op        += (n_dynamic - n_dynamic_ind) + play_.num_var_op();
+        size_t n_arg = 1 + n_con + n_vec;
+        n_arg       += play_.num_dynamic_arg();
+        n_arg       += play_.num_var_arg() + play_.num_var_op();
+        val_tape.reserve(n_op, n_arg, n_con, n_vec);
+    }
     //
     // val_tape, vec_info_vec
     // Put dynamic vectors in val_tape and create vec_info_vec
@@ -254,8 +270,9 @@ void ADFun<Base, RecBase>::fun2val(
     for(addr_t i = 0; i < addr_t( n_dynamic_ind ); ++i)
         par2val_index[i + 1] = i;
     //
-    // val_op_arg, var_op_res, res_is_par;
-    Vector<addr_t> val_op_arg, var_op_res;
+    // val_op_arg, var_op_res, res_is_par, add, sub
+    // These are work vectors so their memory is reused for each operator.
+    Vector<addr_t> val_op_arg, var_op_res, add, sub;
     Vector<bool>   res_is_par;
     //
     // i_arg
@@ -752,7 +769,8 @@ void ADFun<Base, RecBase>::fun2val(
             case local::CSumOp:
             {   //
                 // add, sub
-                Vector<addr_t> add, sub;
+                add.resize(0);
+                sub.resize(0);
                 //
                 // add: constant term
                 add.push_back( ensure_par2val_index( var_op_arg[0] ) );
@@ -2,7 +2,7 @@
 # define  CPPAD_LOCAL_VAL_GRAPH_RECORD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023-25 Bradley M. Bell
+// SPDX-FileContributor: 2023-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/val_graph/tape.hpp>
 # include <cppad/local/val_graph/op_enum2class.hpp>
@@ -93,6 +93,83 @@ addr_t tape_t<Value>::set_ind(addr_t n_ind)
 }
 /*
 -------------------------------------------------------------------------------
+{xrst_begin val_reserve dev}
+
+Reserving Memory for a Recording
+################################
+
+reserve
+*******
+{xrst_literal
+    // BEGIN_RESERVE
+    // END_RESERVE
+}
+This is an optional step that can be done directly after
+:ref:`val_set_ind-name` .
+It increases the capacity of the vectors that hold the recording
+so that they do not need to be reallocated and copied
+while the operators are recorded.
+It does not change the contents of the tape.
+The arguments are upper bounds that are just hints;
+i.e., recording more than specified is allowed
+but will require reallocation.
+
+n_op
+====
+is the number of operators that will be in the tape.
+
+n_arg
+=====
+is the number of elements that will be in
+:ref:`val_tape@arg_vec` .
+
+n_con
+=====
+is the number of value constants that will be in
+:ref:`val_tape@con_vec` .
+
+n_vec
+=====
+is the number of dynamic vectors that will be in
+:ref:`val_tape@vec_initial` .
+
+{xrst_end val_reserve}
+*/
+// ----------------------------------------------------------------------------
+// reserve_vector
+// CppAD::vector::resize does not release memory when the size decreases.
+template <class Type>
+void reserve_vector(Vector<Type>& vec, size_t capacity)
+{   size_t size = vec.size();
+    if( vec.capacity() < capacity )
+    {   vec.resize(capacity);
+        vec.resize(size);
+    }
+}
+// BEGIN_RESERVE
+template <class Value>
+void tape_t<Value>::reserve(
+    size_t n_op, size_t n_arg, size_t n_con, size_t n_vec)
+// END_RESERVE
+{   //
+    // op_enum_vec_, var_arg_, con_vec_
+    reserve_vector(op_enum_vec_, n_op);
+    reserve_vector(var_arg_,     n_arg);
+    reserve_vector(con_vec_,     n_con);
+    //
+    // vec_initial_
+    // swap the inner vectors so they are not copied
+    if( vec_initial_.capacity() < n_vec )
+    {   size_t size = vec_initial_.size();
+        Vector< Vector<addr_t> > new_vec(n_vec);
+        for(size_t i = 0; i < size; ++i)
+            new_vec[i].swap( vec_initial_[i] );
+        new_vec.resize(size);
+        vec_initial_.swap(new_vec);
+    }
+}
+/*
+-------------------------------------------------------------------------------
 {xrst_begin val_set_dep dev}
 
 Setting the Dependent Variables
@@ -696,7 +773,12 @@ addr_t tape_t<Value>::record_vec_op(const Vector<addr_t>& initial)
     addr_t which_vector = addr_t( vec_initial_.size() );
     //
     // vec_initial_
-    vec_initial_.push_back( initial );
+    // Use swap, instead of push_back, so that growing vec_initial_ does not
+    // copy the initial index vectors for all the previous dynamic vectors.
+    if( vec_initial_.size() == vec_initial_.capacity() )
+        reserve(0, 0, 0, 2 * vec_initial_.size() + 1);
+    vec_initial_.resize( size_t(which_vector) + 1 );
+    vec_initial_[which_vector] = initial;
     //
     // op_enum_vec_
     op_enum_vec_.push_back( uint8_t(vec_op_enum) );
@@ -2,7 +2,7 @@
 # define  CPPAD_LOCAL_VAL_GRAPH_TAPE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023-25 Bradley M. Bell
+// SPDX-FileContributor: 2023-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/val_graph/op_iterator.hpp>
 # include <cppad/local/val_graph/op_enum2class.hpp>
@@ -372,6 +372,9 @@ public :
     // set_ind
     addr_t set_ind(addr_t n_ind);
     //
+    // reserve
+    void reserve(size_t n_op, size_t n_arg, size_t n_con, size_t n_vec);
+    //
     // record_op
     addr_t record_op(op_enum_t op_enum, const Vector<addr_t>& op_arg);
     //
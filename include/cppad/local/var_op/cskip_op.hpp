@@ -2,8 +2,9 @@
 # define CPPAD_LOCAL_VAR_OP_CSKIP_OP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
+# include <cppad/local/play/skip_run.hpp>
 
 namespace CppAD { namespace local { namespace var_op {
 /*!
@@ -85,6 +86,37 @@ to back up to get to the start of this operation.
 
 {xrst_end var_cskip_op}
 ------------------------------------------------------------------------------
+{xrst_begin var_cskip_compare_0 dev}
+
+Zero Order Comparison for a Conditional Skip Operator
+#####################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_CSKIP_COMPARE_0
+    // END_CSKIP_COMPARE_0
+}
+
+arg
+***
+Only *arg* [0] through *arg* [3] are used; see
+:ref:`var_cskip_op@arg` .
+
+i_z, num_par, parameter, cap_order, taylor
+******************************************
+see :ref:`var_cskip_forward_0-name` .
+
+branch
+******
+The return value *branch* is 0 if the left and right operands are not
+:ref:`base_identical@Identical@IdenticalCon` ; i.e.,
+no operators can be skipped.
+Otherwise it is 1 (2) if the comparison result is true (false); i.e.,
+the operators in the true (false) list can be skipped.
+
+{xrst_end var_cskip_compare_0}
+------------------------------------------------------------------------------
 {xrst_begin var_cskip_forward_0 dev}
 
 Zero Order Forward Conditional Skip Operator
@@ -141,19 +173,17 @@ the call may add more true values to *cskip_op* .
 
 {xrst_end var_cskip_forward_0}
 */
-// BEGIN_CSKIP_FORWARD_0
+// BEGIN_CSKIP_COMPARE_0
 template <class Base>
-inline void cskip_forward_0(
+inline size_t cskip_compare_0(
     size_t               i_z            ,
     const addr_t*        arg            ,
     size_t               num_par        ,
     const Base*          parameter      ,
     size_t               cap_order      ,
-    Base*                taylor         ,
-    bool*                cskip_op       )
-// END_CSKIP_FORWARD_0
+    const Base*          taylor         )
+// END_CSKIP_COMPARE_0
 {   //
-    //
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < size_t(CompareNe) );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
     //
@@ -180,7 +210,7 @@ inline void cskip_forward_0(
     }
     bool ok_to_skip = IdenticalCon(left) && IdenticalCon(right);
     if( ! ok_to_skip )
-        return;
+        return 0;
 
     // initialize to avoid compiler warning
     bool true_case = false;
@@ -214,15 +244,108 @@ inline void cskip_forward_0(
         default:
         CPPAD_ASSERT_UNKNOWN(false);
     }
+    //
+    // branch
     if( true_case )
+        return 1;
+    return 2;
+}
+// BEGIN_CSKIP_FORWARD_0
+template <class Base>
+inline void cskip_forward_0(
+    size_t               i_z            ,
+    const addr_t*        arg            ,
+    size_t               num_par        ,
+    const Base*          parameter      ,
+    size_t               cap_order      ,
+    Base*                taylor         ,
+    bool*                cskip_op       )
+// END_CSKIP_FORWARD_0
+{   //
+    // branch
+    size_t branch = cskip_compare_0(
+        i_z, arg, num_par, parameter, cap_order, taylor
+    );
+    if( branch == 1 )
     {   for(addr_t i = 0; i < arg[4]; i++)
             cskip_op[ arg[6+i] ] = true;
     }
-    else
+    else if( branch == 2 )
     {   for(addr_t i = 0; i < arg[5]; i++)
             cskip_op[ arg[6+arg[4]+i] ] = true;
     }
     return;
 }
+/*
+------------------------------------------------------------------------------
+{xrst_begin var_cskip_run_valid dev}
+
+Check if a Run of Operators is Skipped
+######################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_CSKIP_RUN_VALID
+    // END_CSKIP_RUN_VALID
+}
+
+run
+***
+is a pointer to the fields for a run of contiguous operators
+in one of the skip lists for a CSkipOp; see ``skip_run_t``
+in the file ``include/cppad/local/play/skip_run.hpp`` .
+If *run* is null, the return value is false.
+
+i_z, num_par, parameter, cap_order, taylor
+******************************************
+see :ref:`var_cskip_forward_0-name` where *i_z* is greater than or equal
+the variable index for the CSkipOp.
+
+cskip_op
+********
+is the vector of skip flags during or after a zero order forward sweep
+that has passed the CSkipOp.
+
+valid
+*****
+The return value *valid* is true if the CSkipOp was evaluated
+and its comparison result corresponds to the run.
+In this case *cskip_op* is true for every operator in the run
+and a sweep can jump over the entire run.
+
+{xrst_end var_cskip_run_valid}
+*/
+// BEGIN_CSKIP_RUN_VALID
+template <class Base>
+inline bool cskip_run_valid(
+    const addr_t*        run            ,
+    size_t               i_z            ,
+    size_t               num_par        ,
+    const Base*          parameter      ,
+    size_t               cap_order      ,
+    const Base*          taylor         ,
+    const bool*          cskip_op       )
+// END_CSKIP_RUN_VALID
+{   typedef play::skip_run_t skip_run_t;
+    //
+    if( run == nullptr )
+        return false;
+    //
+    // If the CSkipOp was skipped, it did not set the flags for this run.
+    if( cskip_op[ run[skip_run_t::cskip_op_field] ] )
+        return false;
+    //
+    // branch
+    size_t branch = cskip_compare_0(
+        i_z,
+        run + skip_run_t::compare_field,
+        num_par,
+        parameter,
+        cap_order,
+        taylor
+    );
+    return branch == size_t( run[skip_run_t::branch_field] );
+}
 } } } // END namespace
 # endif
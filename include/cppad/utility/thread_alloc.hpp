@@ -2,13 +2,14 @@
 # define CPPAD_UTILITY_THREAD_ALLOC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <sstream>
 # include <limits>
 # include <memory>
 # include <cstdint>
+# include <atomic>
 
 
 # ifdef _MSC_VER
@@ -18,9 +19,18 @@
 # pragma warning(disable:4345)
 # endif
 
+# include <cppad/configure.hpp>
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/define.hpp>
 # include <cppad/local/set_get_in_parallel.hpp>
+# include <cppad/local/parallel_setup_count.hpp>
+
+# if CPPAD_HAS_MADVISE_HUGEPAGE
+# include <sys/mman.h>
+# endif
+# if CPPAD_HAS_SYSCONF_PAGESIZE
+# include <unistd.h>
+# endif
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
 \file thread_alloc.hpp
@@ -56,6 +66,13 @@ that correspond to this thead and capacity CPPAD_TRACE_CAPACITY.
 */
 # define CPPAD_TRACE_THREAD 0
 
+/*!
+\def CPPAD_HUGE_PAGE_BYTES
+Number of bytes in a huge page. Memory that is allocated using huge pages
+is aligned to, and its size is a multiple of, this value.
+*/
+# define CPPAD_HUGE_PAGE_BYTES 2097152
+
 /*
 Note that Section 3.6.2 of ISO/IEC 14882:1998(E) states: "The storage for
 objects with static storage duration (3.7.1) shall be zero-initialized
@@ -142,6 +159,13 @@ private:
         this structure from the structure for the next thread.
         */
         block_t root_inuse_[CPPAD_MAX_NUM_CAPACITY];
+        /*!
+        list of blocks for this thread that were returned by other threads
+        during parallel mode (linked using the extra_ field of block_t).
+        Other threads only push onto this list and this thread only
+        removes the entire list; see drain_remote.
+        */
+        std::atomic<void*> remote_return_;
     };
     // ---------------------------------------------------------------------
     /*!
@@ -165,6 +189,201 @@ private:
     }
     // ---------------------------------------------------------------------
     /*!
+    Set and Get first touch flag.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially false).
+    */
+    static bool set_get_first_touch(bool set, bool new_value = false)
+    {   static bool value = false;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set and Get huge page minimum number of bytes.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially zero).
+    */
+    static size_t set_get_huge_page(bool set, size_t new_value = 0)
+    {   static size_t value = 0;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Offset added to tc_index_ for a block that was allocated using huge pages.
+    */
+    static size_t huge_offset(void)
+    {   return CPPAD_MAX_NUM_THREADS * capacity_info()->number; }
+    // ---------------------------------------------------------------------
+    /*!
+    Number of bytes in a huge page allocation.
+
+    \param num_bytes [in]
+    is the number of bytes requested.
+
+    \return
+    is num_bytes rounded up to a multiple of CPPAD_HUGE_PAGE_BYTES.
+    */
+    static size_t huge_page_bytes(size_t num_bytes)
+    {   size_t page = CPPAD_HUGE_PAGE_BYTES;
+        return ( (num_bytes + page - 1) / page ) * page;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Number of bytes in a system page.
+
+    \return
+    is the value of sysconf(_SC_PAGESIZE) when CPPAD_HAS_SYSCONF_PAGESIZE
+    is true, and 4096 otherwise.
+    The first call should be in sequential execution mode; see numa_setup.
+    */
+    static size_t system_page_bytes(void)
+    {   static size_t page = 0;
+        if( page != 0 )
+            return page;
+        page = 4096;
+# if CPPAD_HAS_SYSCONF_PAGESIZE
+        long sys_page = sysconf(_SC_PAGESIZE);
+        if( sys_page > 0 )
+            page = size_t( sys_page );
+# endif
+        return page;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Get memory from the system.
+
+    \param num_bytes [in]
+    is the number of bytes of memory to get.
+
+    \param huge [out]
+    is true (false) if the memory was (was not) allocated using huge pages.
+
+    \return
+    is a pointer to the memory.
+    */
+    static void* system_alloc(size_t num_bytes, bool& huge)
+    {   huge = false;
+# if CPPAD_HAS_MADVISE_HUGEPAGE
+        size_t min_bytes = set_get_huge_page(false);
+        if( min_bytes != 0 && min_bytes <= num_bytes )
+        {   // map an extra page so that the result can be aligned
+            size_t page   = CPPAD_HUGE_PAGE_BYTES;
+            size_t length = huge_page_bytes(num_bytes);
+            void* v_map   = mmap(
+                nullptr, length + page,
+                PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+            );
+            if( v_map != MAP_FAILED )
+            {   // unmap the memory before and after the aligned region
+                char* c_map  = reinterpret_cast<char*>(v_map);
+                std::uintptr_t i_map = reinterpret_cast<std::uintptr_t>(v_map);
+                size_t before  = (page - i_map % page) % page;
+                size_t after   = page - before;
+                if( before > 0 )
+                    munmap(c_map, before);
+                if( after > 0 )
+                    munmap(c_map + before + length, after);
+                //
+                // advise the system to use huge pages for this memory
+                void* v_ptr = reinterpret_cast<void*>(c_map + before);
+                madvise(v_ptr, length, MADV_HUGEPAGE);
+                huge = true;
+                return v_ptr;
+            }
+        }
+# endif
+        void* v_ptr = ::operator new(num_bytes);
+        CPPAD_ASSERT_UNKNOWN( v_ptr != nullptr );
+        return v_ptr;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Return memory to the system.
+
+    \param v_ptr [in]
+    is the pointer returned by system_alloc.
+
+    \param num_bytes [in]
+    is the number of bytes in the corresponding call to system_alloc.
+
+    \param huge [in]
+    is the value of huge returned by the corresponding call to system_alloc.
+    */
+# if CPPAD_HAS_MADVISE_HUGEPAGE
+    static void system_free(void* v_ptr, size_t num_bytes, bool huge)
+    {   if( huge )
+        {   munmap(v_ptr, huge_page_bytes(num_bytes) );
+            return;
+        }
+        ::operator delete(v_ptr);
+    }
+# else
+    // huge is always false in this case
+    static void system_free(void* v_ptr, size_t, bool)
+    {   ::operator delete(v_ptr); }
+# endif
+    // ---------------------------------------------------------------------
+    /*!
+    Set and call the routine that determines the NUMA node for a thread.
+
+    \param thread [in]
+    If set is false, this is the thread we are determining the node for.
+    Otherwise, it is not used.
+
+    \param node_num_new [in]
+    If set is false, node_num_new it is not used.
+    Otherwise, the current value of node_num_new becomes the
+    most recent setting for node_num.
+
+    \param set
+    If set is true, then node_num_new is becomes the most
+    recent setting for this set_get_numa_node.
+
+    \return
+    If set is true,
+    or the most recent setting is nullptr (its initial value),
+    the return value is zero.
+    Otherwise the routine corresponding to the most recent setting
+    is called with thread as its argument and its value returned.
+    */
+    static size_t set_get_numa_node(
+        size_t thread                            ,
+        size_t (*node_num_new)(size_t) = nullptr ,
+        bool   set = false                       )
+    {   static size_t (*node_num_user)(size_t) = nullptr;
+
+        if( set )
+        {   node_num_user = node_num_new;
+            return 0;
+        }
+
+        if( node_num_user == nullptr )
+            return 0;
+
+        return node_num_user(thread);
+    }
+    // ---------------------------------------------------------------------
+    /*!
     Get pointer to the information for this thread.
 
     \param thread [in]
@@ -205,7 +424,8 @@ private:
 # ifndef NDEBUG
                 CPPAD_ASSERT_UNKNOWN(
                     info->count_inuse_     == 0 &&
-                    info->count_available_ == 0
+                    info->count_available_ == 0 &&
+                    info->remote_return_.load() == nullptr
                 );
                 for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
                 {   CPPAD_ASSERT_UNKNOWN(
@@ -226,7 +446,7 @@ private:
             else
             {   size_t size = sizeof(thread_alloc_info);
                 void* v_ptr = ::operator new(size);
-                info        = reinterpret_cast<thread_alloc_info*>(v_ptr);
+                info        = new(v_ptr) thread_alloc_info;
             }
             all_info[thread] = info;
 
@@ -237,6 +457,7 @@ private:
             }
             info->count_inuse_     = 0;
             info->count_available_ = 0;
+            info->remote_return_.store(nullptr, std::memory_order_relaxed);
         }
         return info;
     }
@@ -334,6 +555,36 @@ private:
         CPPAD_ASSERT_UNKNOWN( info->count_available_ >= dec );
         info->count_available_ =  info->count_available_ - dec;
     }
+    // -----------------------------------------------------------------------
+    /*!
+    Return the memory that other threads have returned for a thread.
+
+    \param thread [in]
+    Thread for which we are returning the memory.
+    During parallel execution, this must be the thread
+    that is currently executing.
+    */
+    static void drain_remote(size_t thread)
+    {   CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        thread_alloc_info* info = thread_info(thread);
+        //
+        // check for the common case where the list is empty
+        std::atomic<void*>& remote = info->remote_return_;
+        if( remote.load(std::memory_order_relaxed) == nullptr )
+            return;
+        //
+        // remove the entire list (other threads may push new elements)
+        void* v_node = remote.exchange(nullptr, std::memory_order_acquire);
+        while( v_node != nullptr )
+        {   block_t* node = reinterpret_cast<block_t*>(v_node);
+            v_node        = reinterpret_cast<void*>( node->extra_ );
+            //
+            // this thread now owns the node, so this is a local return
+            return_memory( reinterpret_cast<void*>(node + 1) );
+        }
+    }
 
     // ----------------------------------------------------------------------
     /*!
@@ -473,6 +724,12 @@ as soon as a new thread is executing,
 one must be certain that *thread_num* () will
 work for that thread.
 
+Between calls to ``parallel_setup`` ,
+the value *thread_num* () returns for a system thread must not change
+while that thread is using ``AD`` < *Base* > operations.
+This is because the ``AD`` < *Base* > operations cache the
+thread number for each system thread.
+
 Restrictions
 ************
 The function ``parallel_setup`` must be called before
@@ -507,6 +764,10 @@ contain examples and tests that use this function.
         bool (*in_parallel)(void)  ,
         size_t (*thread_num)(void) )
     {
+        // values cached for each system thread may no longer be valid
+        bool increment = true;
+        CppAD::local::parallel_setup_count(increment);
+
         // Special case where we go back to single thread mode right away
         // (previous settings may no longer be valid)
         if( num_threads == 1 )
@@ -778,6 +1039,9 @@ Example
         size_t tc_index          = thread * num_cap + c_index;
         thread_alloc_info* info  = thread_info(thread);
 
+        // memory returned by other threads can now be used by this thread
+        drain_remote(thread);
+
 # ifndef NDEBUG
         // trace allocation
         static bool first_trace = true;
@@ -802,7 +1066,7 @@ Example
         void* v_node              = available_root->next_;
         block_t* node             = reinterpret_cast<block_t*>(v_node);
         if( node != nullptr )
-        {   CPPAD_ASSERT_UNKNOWN( node->tc_index_ == tc_index );
+        {   CPPAD_ASSERT_UNKNOWN( node->tc_index_ % huge_offset() == tc_index );
 
             // remove node from available list
             available_root->next_ = node->next_;
@@ -839,12 +1103,24 @@ Example
         // Create a new node with thread_alloc information at front.
         // This uses the system allocator, which is thread safe, but slower,
         // because the thread might wait for a lock on the allocator.
-        v_node          = ::operator new(sizeof(block_t) + cap_bytes);
-        CPPAD_ASSERT_UNKNOWN( v_node != nullptr );
+        // (Large requests may use huge pages; see huge_page.)
+        bool huge;
+        v_node          = system_alloc(sizeof(block_t) + cap_bytes, huge);
         node            = reinterpret_cast<block_t*>(v_node);
         node->tc_index_ = tc_index;
+        if( huge )
+            node->tc_index_ += huge_offset();
         void* v_ptr     = reinterpret_cast<void*>(node + 1);
 
+        // Write one byte in each page so that, under a first touch policy,
+        // the pages are placed on the NUMA node for this thread.
+        if( set_get_first_touch(false) )
+        {   size_t page_bytes = system_page_bytes();
+            char* c_ptr = reinterpret_cast<char*>(v_ptr);
+            for(size_t i = 0; i < cap_bytes; i += page_bytes)
+                c_ptr[i] = 0;
+        }
+
 # ifndef NDEBUG
 # if ! CPPAD_DEBUG_AND_RELEASE
         // add node to inuse list
@@ -894,16 +1170,29 @@ obtained by a previous call to
 
 Thread
 ******
-Either the :ref:`current thread<ta_thread_num-name>` must be the same as during
-the corresponding call to :ref:`get_memory<ta_get_memory-name>` ,
-or the current execution mode must be sequential
-(not :ref:`parallel<ta_in_parallel-name>` ).
+Any thread can return the memory; e.g.,
+one thread can allocate a ``CppAD::vector`` and another thread can free it.
+
+Remote Return
+=============
+Suppose that the current execution mode is
+:ref:`parallel<ta_in_parallel-name>` and the
+:ref:`current thread<ta_thread_num-name>` is different from the thread
+during the corresponding call to :ref:`get_memory<ta_get_memory-name>` .
+In this case the memory is put on a remote return list for the
+thread that allocated it (without waiting for a lock).
+The memory remains :ref:`in use<ta_inuse-name>` for the allocating thread
+until it is moved from its remote return list.
+This is done by the next call to ``get_memory`` , ``inuse`` ,
+``available`` , or ``free_available`` for the allocating thread.
 
 NDEBUG
 ******
 If ``NDEBUG`` is defined, *v_ptr* is not checked (this is faster).
 Otherwise, a list of in use pointers is searched to make sure
 that *v_ptr* is in the list.
+In the remote return case, this check is done when the memory is moved
+from the remote return list.
 
 Example
 *******
@@ -923,27 +1212,40 @@ Example
     After this call, this pointer will available (and not in use).
 
     \par
-    We must either be in sequential (not parallel) execution mode,
-    or the current thread must be the same as for the corresponding call
-    to get_memory.
+    If we are in parallel execution mode and the current thread is not
+    the same as for the corresponding call to get_memory,
+    the memory is put on the remote return list for that thread;
+    see drain_remote.
     */
     static void return_memory(void* v_ptr)
     {   size_t num_cap   = capacity_info()->number;
 
         block_t* node    = reinterpret_cast<block_t*>(v_ptr) - 1;
-        size_t tc_index  = node->tc_index_;
+        bool   huge      = node->tc_index_ >= huge_offset();
+        size_t tc_index  = node->tc_index_ % huge_offset();
         size_t thread    = tc_index / num_cap;
         size_t c_index   = tc_index % num_cap;
         size_t capacity  = capacity_info()->value[c_index];
 
         CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
-        CPPAD_ASSERT_KNOWN(
-            thread == thread_num() || (! in_parallel()),
-            "Attempt to return memory for a different thread "
-            "while in parallel mode"
-        );
-
         thread_alloc_info* info = thread_info(thread);
+
+        // case where a different thread is returning the memory
+        // while in parallel mode
+        if( in_parallel() && thread != thread_num() )
+        {   // push node onto the remote return list for thread
+            void* v_node = reinterpret_cast<void*>(node);
+            std::atomic<void*>& remote = info->remote_return_;
+            void* head = remote.load(std::memory_order_relaxed);
+            do
+            {   node->extra_ = reinterpret_cast<std::uintptr_t>(head);
+            }
+            while( ! remote.compare_exchange_weak(
+                head, v_node, std::memory_order_release,
+                std::memory_order_relaxed
+            ) );
+            return;
+        }
 # ifndef NDEBUG
 # if ! CPPAD_DEBUG_AND_RELEASE
         // remove node from inuse list
@@ -985,7 +1287,9 @@ Example
 
         // check for case where we just return the memory to the system
         if( ! set_get_hold_memory(false) )
-        {   ::operator delete( reinterpret_cast<void*>(node) );
+        {   system_free(
+                reinterpret_cast<void*>(node), sizeof(block_t) + capacity, huge
+            );
             return;
         }
 
@@ -1060,6 +1364,9 @@ Example
             "while in parallel mode"
         );
 
+        // memory returned by other threads is now available
+        drain_remote(thread);
+
         size_t num_cap = capacity_info()->number;
         if( num_cap == 0 )
             return;
@@ -1073,7 +1380,8 @@ Example
             while( v_ptr != nullptr )
             {   block_t* node = reinterpret_cast<block_t*>(v_ptr);
                 void* next    = node->next_;
-                ::operator delete(v_ptr);
+                bool  huge    = node->tc_index_ >= huge_offset();
+                system_free(v_ptr, sizeof(block_t) + capacity, huge);
                 v_ptr         = next;
 
                 dec_available(capacity, thread);
@@ -1131,6 +1439,202 @@ to the system using :ref:`free_available<ta_free_available-name>` .
     {   bool set = true;
         set_get_hold_memory(set, value);
     }
+/* -----------------------------------------------------------------------
+{xrst_begin ta_numa_setup}
+{xrst_spell
+    mbind
+    numa
+}
+
+Setup thread_alloc For Use on a NUMA System
+###########################################
+
+Syntax
+******
+| ``thread_alloc::numa_setup`` ( *first_touch* , *node_num* )
+| *node* = ``thread_alloc::numa_node`` ( *thread* )
+
+Purpose
+*******
+On a Non-Uniform Memory Access (NUMA) system,
+memory is faster for a thread if it is on the same node as the
+processor that the thread is running on.
+Most systems place a page of memory on the node for the thread
+that first writes to the page (first touch policy).
+
+Thread Lists
+============
+The memory that ``thread_alloc`` holds for quick use is kept
+in a separate list for each thread.
+In addition, memory is always returned to the list for the thread
+that allocated it; see :ref:`ta_return_memory-name` .
+Hence memory that is held by ``thread_alloc`` is not reused by a
+thread that is on a different node
+(as long as each thread stays on the same node).
+
+first_touch
+***********
+This argument has prototype
+
+    ``bool`` *first_touch*
+
+If it is true, each time ``thread_alloc`` gets new memory from the system
+it writes one byte in each page of the memory
+(the page size is ``sysconf(_SC_PAGESIZE)`` on systems that support it
+and 4096 otherwise)
+(using the thread that is allocating the memory).
+This places the pages that have not yet been used on the node for
+that thread.
+Memory that the system allocator has already used
+is not moved to a different node.
+By default (when ``numa_setup`` has not been called)
+*first_touch* is false.
+
+node_num
+********
+This argument has prototype
+
+    ``size_t`` *node_num* ( ``size_t`` *thread* )
+
+It must return the node that the specified thread is running on.
+If it is ``nullptr`` , all the threads are considered to be on node zero.
+This is the default (when ``numa_setup`` has not been called).
+It is the users responsibility to bind the threads to nodes;
+``thread_alloc`` does not call a system routine like ``mbind``
+to move memory between nodes.
+
+node
+****
+The return value *node* has prototype
+
+    ``size_t`` *node*
+
+It is the value of *node_num* ( *thread* ) for the most recent call
+to ``numa_setup`` ,
+or zero if *node_num* was ``nullptr`` .
+
+Restrictions
+************
+The function ``numa_setup`` cannot be called while in parallel mode.
+
+Example
+*******
+:ref:`thread_alloc.cpp-name`
+
+{xrst_end ta_numa_setup}
+*/
+    /*!
+    Change the thread_alloc NUMA settings.
+
+    \param first_touch [in]
+    If true, one byte is written to each page of new memory by the
+    thread that allocates it.
+
+    \param node_num [in]
+    Is the routine that determines the NUMA node for a thread
+    (nullptr means all threads are on node zero).
+    */
+    static void numa_setup(bool first_touch, size_t (*node_num)(size_t))
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel(),
+            "numa_setup cannot be used while in parallel execution"
+        );
+        bool set = true;
+        set_get_first_touch(set, first_touch);
+        //
+        // initialize static page size while in sequential mode
+        system_page_bytes();
+        set_get_numa_node(0, node_num, set);
+    }
+    /// Get the NUMA node for a thread
+    static size_t numa_node(size_t thread)
+    {   return set_get_numa_node(thread); }
+/* -----------------------------------------------------------------------
+{xrst_begin ta_huge_page}
+{xrst_spell
+    hugepage
+    madv
+    madvise
+    mmap
+    tlb
+}
+
+Use Huge Pages For Large Memory Allocations
+###########################################
+
+Syntax
+******
+| ``thread_alloc::huge_page`` ( *min_bytes* )
+| *min_bytes* = ``thread_alloc::huge_page`` ()
+
+Purpose
+*******
+Large arrays, e.g., the Taylor coefficients for a large ``ADFun`` object,
+can have many translation lookaside buffer (TLB) misses
+when they use the standard page size.
+This setting instructs ``thread_alloc`` to use ``mmap`` ,
+and ``madvise`` with ``MADV_HUGEPAGE`` , when it gets large amounts of
+memory from the system.
+The memory is aligned to a 2MB boundary so that the system can use
+transparent huge pages for it.
+
+min_bytes
+*********
+This argument and result has prototype
+
+    ``size_t`` *min_bytes*
+
+If it is zero, huge pages are not used.
+Otherwise, huge pages are used when ``thread_alloc`` gets at least
+*min_bytes* of memory from the system.
+By default (when ``huge_page`` has not been called) *min_bytes* is zero.
+The syntax without an argument returns the current setting.
+
+CPPAD_HAS_MADVISE_HUGEPAGE
+**************************
+If the preprocessor symbol ``CPPAD_HAS_MADVISE_HUGEPAGE`` is zero,
+this system does not support huge pages and
+this setting is recorded but it has no effect.
+
+Memory Accounting
+*****************
+The :ref:`inuse<ta_inuse-name>` and :ref:`available<ta_available-name>`
+amounts do not depend on this setting; i.e.,
+they do not include the extra bytes used to round up to a multiple of 2MB.
+This rounding is small compared to *min_bytes* when *min_bytes* is large.
+Memory that uses huge pages is held by ``thread_alloc`` ,
+and returned to the system, in the same way as other memory;
+see :ref:`ta_hold_memory-name` and :ref:`ta_free_available-name` .
+
+Restrictions
+************
+The function ``huge_page`` ( *min_bytes* ) cannot be called while in
+parallel mode.
+
+Example
+*******
+:ref:`thread_alloc.cpp-name`
+
+{xrst_end ta_huge_page}
+*/
+    /*!
+    Change the thread_alloc huge page setting.
+
+    \param min_bytes [in]
+    Minimum number of bytes for an allocation that uses huge pages
+    (zero means do not use huge pages).
+    */
+    static void huge_page(size_t min_bytes)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel(),
+            "huge_page cannot be used while in parallel execution"
+        );
+        bool set = true;
+        set_get_huge_page(set, min_bytes);
+    }
+    /// Get the thread_alloc huge page setting.
+    static size_t huge_page(void)
+    {   return set_get_huge_page(false); }
 
 /* -----------------------------------------------------------------------
 {xrst_begin ta_inuse}
@@ -1191,6 +1695,7 @@ Example
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_inuse_;
     }
@@ -1246,10 +1751,101 @@ Example
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_available_;
     }
 /* -----------------------------------------------------------------------
+{xrst_begin ta_numa_inuse}
+{xrst_spell
+    numa
+}
+
+Amount of Memory In Use and Available on a NUMA Node
+####################################################
+
+Syntax
+******
+| *num_bytes* = ``thread_alloc::numa_inuse`` ( *node* )
+| *num_bytes* = ``thread_alloc::numa_available`` ( *node* )
+
+Purpose
+*******
+These functions sum the :ref:`inuse<ta_inuse-name>`
+and :ref:`available<ta_available-name>` memory
+for all the threads that are on the specified node.
+A thread is on the node if
+
+    ``thread_alloc::numa_node`` ( *thread* ) == *node*
+
+see :ref:`ta_numa_setup@node` .
+
+node
+****
+This argument has prototype
+
+    ``size_t`` *node*
+
+num_bytes
+*********
+The return value has prototype
+
+    ``size_t`` *num_bytes*
+
+It is the number of bytes in use (available) for all the threads,
+less than :ref:`num_threads<ta_num_threads-name>` ,
+that are on the specified node.
+
+Restrictions
+************
+These functions cannot be called while in parallel mode.
+
+Example
+*******
+:ref:`thread_alloc.cpp-name`
+
+{xrst_end ta_numa_inuse}
+*/
+    /*!
+    Determine the amount of memory that is currently inuse on a NUMA node.
+
+    \param node [in]
+    NUMA node for which we are determining the amount of memory.
+
+    \return
+    The amount of memory in bytes.
+    */
+    static size_t numa_inuse(size_t node)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel(),
+            "numa_inuse cannot be used while in parallel execution"
+        );
+        size_t result = 0;
+        for(size_t thread = 0; thread < num_threads(); ++thread)
+        {   if( numa_node(thread) == node )
+                result += inuse(thread);
+        }
+        return result;
+    }
+    /*!
+    Determine the amount of memory that is currently available
+    on a NUMA node.
+
+    \copydetails numa_inuse
+    */
+    static size_t numa_available(size_t node)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel(),
+            "numa_available cannot be used while in parallel execution"
+        );
+        size_t result = 0;
+        for(size_t thread = 0; thread < num_threads(); ++thread)
+        {   if( numa_node(thread) == node )
+                result += available(thread);
+        }
+        return result;
+    }
+/* -----------------------------------------------------------------------
 {xrst_begin ta_create_array}
 
 Allocate An Array and Call Default Constructor for its Elements
@@ -1522,4 +2118,5 @@ Example
 # undef CPPAD_MIN_DOUBLE_CAPACITY
 # undef CPPAD_TRACE_CAPACITY
 # undef CPPAD_TRACE_THREAD
+# undef CPPAD_HUGE_PAGE_BYTES
 # endif
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+// Tests of ADFun splice that cover the different operator types
+
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+    using CppAD::AD;
+    using CppAD::ADFun;
+    using CppAD::vector;
+    typedef std::vector< ADFun<double> > fun_vector;
+    //
+    // my_floor
+    double my_floor(const double& x)
+    {   return std::floor(x); }
+    CPPAD_DISCRETE_FUNCTION(double, my_floor);
+    //
+    // check_splice
+    // Check that h is the pieces in fun_vec evaluated at the indices
+    // in var_index and dyn_index. Zero order, first order forward,
+    // and first order reverse are checked.
+    bool check_splice(
+        ADFun<double>&          h         ,
+        fun_vector&             fun_vec   ,
+        const vector<size_t>&   var_index ,
+        const vector<size_t>&   dyn_index ,
+        const vector<double>&   x         ,
+        const vector<double>&   p         )
+    {   bool ok = true;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        // n, m
+        size_t n = h.Domain();
+        size_t m = h.Range();
+        //
+        // h_y, h_dy, h_dw
+        vector<double> dx(n), w(m);
+        for(size_t j = 0; j < n; ++j)
+            dx[j] = double(j + 1);
+        for(size_t i = 0; i < m; ++i)
+            w[i] = double(i + 2);
+        if( p.size() > 0 )
+            h.new_dynamic(p);
+        vector<double> h_y  = h.Forward(0, x);
+        vector<double> h_dy = h.Forward(1, dx);
+        vector<double> h_dw = h.Reverse(1, w);
+        //
+        // f_dw
+        vector<double> f_dw(n);
+        for(size_t j = 0; j < n; ++j)
+            f_dw[j] = 0.0;
+        //
+        size_t sum_var = 0;
+        size_t sum_dyn = 0;
+        size_t sum_ran = 0;
+        for(size_t k = 0; k < fun_vec.size(); ++k)
+        {   ADFun<double>& f_k = fun_vec[k];
+            size_t n_k = f_k.Domain();
+            size_t m_k = f_k.Range();
+            size_t d_k = f_k.size_dyn_ind();
+            vector<double> x_k(n_k), dx_k(n_k), p_k(d_k), w_k(m_k);
+            for(size_t j = 0; j < n_k; ++j)
+            {   x_k[j]  = x[ var_index[sum_var + j] ];
+                dx_k[j] = dx[ var_index[sum_var + j] ];
+            }
+            for(size_t j = 0; j < d_k; ++j)
+                p_k[j] = p[ dyn_index[sum_dyn + j] ];
+            for(size_t i = 0; i < m_k; ++i)
+                w_k[i] = w[sum_ran + i];
+            if( d_k > 0 )
+                f_k.new_dynamic(p_k);
+            vector<double> y_k  = f_k.Forward(0, x_k);
+            vector<double> dy_k = f_k.Forward(1, dx_k);
+            vector<double> dw_k = f_k.Reverse(1, w_k);
+            for(size_t i = 0; i < m_k; ++i)
+            {   ok &= CppAD::NearEqual(h_y[sum_ran + i], y_k[i], eps99, eps99);
+                ok &= CppAD::NearEqual(
+                    h_dy[sum_ran + i], dy_k[i], eps99, eps99
+                );
+            }
+            for(size_t j = 0; j < n_k; ++j)
+                f_dw[ var_index[sum_var + j] ] += dw_k[j];
+            sum_var += n_k;
+            sum_dyn += d_k;
+            sum_ran += m_k;
+        }
+        for(size_t j = 0; j < n; ++j)
+            ok &= CppAD::NearEqual(h_dw[j], f_dw[j], eps99, eps99);
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // optimized pieces: conditional skip, cumulative summation, compare,
+    // discrete, print, and many of the unary and binary operators
+    bool optimized_pieces(void)
+    {   bool ok = true;
+        //
+        // fun_vec
+        fun_vector fun_vec(2);
+        vector< AD<double> > ax(3), ay(2);
+        for(size_t j = 0; j < 3; ++j)
+            ax[j] = 0.5 + double(j);
+        CppAD::Independent(ax);
+        AD<double> sum = ax[0] + ax[1] - ax[2] + 1.0;
+        AD<double> big = exp(ax[0]) * sqrt(ax[1]) / log1p(ax[2]);
+        ay[0] = CondExpLt(ax[0], ax[1], sum, big);
+        ay[1] = erf(ax[0]) + pow(ax[1], ax[2]) + azmul(ax[2], tanh(ax[0]));
+        ay[1] += my_floor(ax[2]) + atan(ax[1]) - asinh(ax[0]);
+        if( ax[0] < ax[2] )
+            ay[1] += 1.0;
+        PrintFor(ax[0], "", ay[1], "\n");
+        fun_vec[0].Dependent(ax, ay);
+        fun_vec[0].optimize();
+        //
+        ax.resize(2);
+        ay.resize(1);
+        CppAD::Independent(ax);
+        ay[0] = CondExpGt(ax[0], ax[1], sin(ax[0]), cos(ax[1]) * ax[0]);
+        ay[0] += 2.0 - ax[0] - ax[1];
+        fun_vec[1].Dependent(ax, ay);
+        fun_vec[1].optimize();
+        //
+        // h
+        vector<size_t> var_index = {0, 1, 2, 2, 0}, dyn_index(0);
+        ADFun<double> h;
+        h.splice(fun_vec, var_index, dyn_index);
+        ok &= h.Domain() == 3;
+        ok &= h.Range() == 3;
+        //
+        // check both cases for each conditional expression
+        vector<double> x = {0.5, 1.5, 2.5}, p(0);
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        x = {1.5, 0.5, 0.25};
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        //
+        // compare operators were copied
+        h.Forward(0, x);
+        ok &= h.compare_change_number() > 0;
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // dynamic parameters and VecAD
+    bool dynamic_pieces(void)
+    {   bool ok = true;
+        //
+        // fun_vec
+        fun_vector fun_vec(2);
+        vector< AD<double> > ax(2), ap(2), ay(2);
+        ax[0] = 0.5;
+        ax[1] = 1.5;
+        ap[0] = 2.0;
+        ap[1] = 3.0;
+        CppAD::Independent(ax, ap);
+        AD<double> ad = ap[0] * sin(ap[1]) + my_floor(ap[1]);
+        ad = CondExpLt(ap[0], ap[1], ad, ap[0] - ap[1]);
+        CppAD::VecAD<double> av(2);
+        av[ AD<double>(0) ] = 4.0;
+        av[ AD<double>(1) ] = 5.0;
+        av[ ax[0] ] = ax[1];
+        ay[0] = ad * ax[0] + av[ AD<double>(1) ];
+        ay[1] = ax[1] / ad + av[ AD<double>(0) ];
+        fun_vec[0].Dependent(ax, ay);
+        //
+        ax.resize(1);
+        ap.resize(1);
+        ay.resize(1);
+        ax[0] = 1.0;
+        ap[0] = 4.0;
+        CppAD::Independent(ax, ap);
+        CppAD::VecAD<double> aw(2);
+        aw[ AD<double>(0) ] = 6.0;
+        aw[ AD<double>(1) ] = 7.0;
+        ay[0] = exp(ap[0]) * ax[0] + aw[ ax[0] ];
+        fun_vec[1].Dependent(ax, ay);
+        //
+        // h
+        // the pieces share the dynamic parameter with index 1 in h
+        vector<size_t> var_index = {0, 1, 1}, dyn_index = {0, 1, 1};
+        ADFun<double> h;
+        h.splice(fun_vec, var_index, dyn_index);
+        ok &= h.size_dyn_ind() == 2;
+        //
+        vector<double> x = {1.0, 0.0}, p = {2.0, 3.0};
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        p = {4.0, 3.0};
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        //
+        // optimize the spliced function
+        h.optimize();
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // atomic function calls with variable and dynamic parameter arguments
+    bool atomic_pieces(void)
+    {   bool ok = true;
+        //
+        // chk
+        // g(u) = [ u_0 * u_1 , sin(u_0) ]
+        vector< AD<double> > au(2), av(2);
+        au[0] = 1.0;
+        au[1] = 2.0;
+        CppAD::Independent(au);
+        av[0] = au[0] * au[1];
+        av[1] = sin( au[0] );
+        ADFun<double> g(au, av);
+        CppAD::chkpoint_two<double> chk(g, "g", false, true, false, false);
+        //
+        // fun_vec
+        fun_vector fun_vec(2);
+        vector< AD<double> > ax(2), ap(1), ay(3);
+        ax[0] = 0.5;
+        ax[1] = 1.5;
+        ap[0] = 2.0;
+        CppAD::Independent(ax, ap);
+        // variable arguments
+        au[0] = ax[0];
+        au[1] = ap[0];
+        chk(au, av);
+        ay[0] = av[0] + av[1];
+        // dynamic parameter arguments
+        au[0] = ap[0];
+        au[1] = 3.0;
+        chk(au, av);
+        ay[1] = av[0] * ax[1];
+        ay[2] = av[1];
+        fun_vec[0].Dependent(ax, ay);
+        //
+        ax.resize(1);
+        ay.resize(1);
+        CppAD::Independent(ax);
+        au[0] = ax[0];
+        au[1] = ax[0];
+        chk(au, av);
+        ay[0] = av[0] - av[1];
+        fun_vec[1].Dependent(ax, ay);
+        //
+        // h
+        vector<size_t> var_index = {1, 0, 0}, dyn_index = {0};
+        ADFun<double> h;
+        h.splice(fun_vec, var_index, dyn_index);
+        //
+        vector<double> x = {0.25, 0.75}, p = {1.5};
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        //
+        h.optimize();
+        p = {2.5};
+        ok &= check_splice(h, fun_vec, var_index, dyn_index, x, p);
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // the spliced function is one of the pieces
+    bool alias_piece(void)
+    {   bool ok = true;
+        //
+        // fun_vec
+        fun_vector fun_vec(2);
+        vector< AD<double> > ax(2), ap(1), ay(2);
+        ax[0] = 0.5;
+        ax[1] = 1.5;
+        ap[0] = 2.0;
+        CppAD::Independent(ax, ap);
+        ay[0] = ap[0] * sin( ax[0] );
+        ay[1] = 3.0;
+        fun_vec[0].Dependent(ax, ay);
+        //
+        ax.resize(1);
+        ay.resize(1);
+        CppAD::Independent(ax);
+        ay[0] = exp( ax[0] ) * ax[0];
+        fun_vec[1].Dependent(ax, ay);
+        //
+        // copy_vec
+        fun_vector copy_vec(2);
+        for(size_t k = 0; k < 2; ++k)
+            copy_vec[k] = fun_vec[k];
+        //
+        // fun_vec[0]
+        vector<size_t> var_index = {0, 1, 0}, dyn_index = {0};
+        fun_vec[0].splice(fun_vec, var_index, dyn_index);
+        ok &= fun_vec[0].Domain() == 2;
+        ok &= fun_vec[0].Range() == 3;
+        //
+        vector<double> x = {0.25, 0.75}, p = {1.5};
+        ok &= check_splice(fun_vec[0], copy_vec, var_index, dyn_index, x, p);
+        //
+        return ok;
+    }
+} // END_EMPTY_NAMESPACE
+
+bool fun_splice(void)
+{   bool ok = true;
+    //
+    ok &= optimized_pieces();
+    ok &= dynamic_pieces();
+    ok &= atomic_pieces();
+    ok &= alias_piece();
+    //
+    return ok;
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // CPPAD_HAS_* defines
@@ -93,6 +93,7 @@ extern bool for_hes_sparsity(void);
 extern bool for_jac_sparsity(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
+extern bool fun_splice(void);
 extern bool hes_sparsity(void);
 extern bool ipopt_solve(void);
 extern bool jacobian(void);
@@ -123,6 +124,8 @@ extern bool subgraph_1(void);
 extern bool subgraph_2(void);
 extern bool subgraph_hes2jac(void);
 extern bool tan(void);
+extern bool tape_cache(void);
+extern bool thread_alloc_remote(void);
 extern bool to_csrc(void);
 extern bool to_string(void);
 // END_SORT_THIS_LINE_MINUS_1
@@ -215,6 +218,7 @@ int main(void)
     Run( for_jac_sparsity, "for_jac_sparsity" );
     Run( forward_dir,     "forward_dir"    );
     Run( forward_order,   "forward_order"  );
+    Run( fun_splice,      "fun_splice"     );
     Run( hes_sparsity,    "hes_sparsity"   );
     Run( jacobian,        "jacobian"       );
     Run( json_graph,      "json_graph"     );
@@ -244,6 +248,8 @@ int main(void)
     Run( subgraph_2,      "subgraph_2"     );
     Run( subgraph_hes2jac, "subgraph_hes2jac" );
     Run( tan,             "tan"            );
+    Run( tape_cache,      "tape_cache"     );
+    Run( thread_alloc_remote, "thread_alloc_remote" );
     Run( to_string,       "to_string"      );
     // END_SORT_THIS_LINE_MINUS_1
 # if CPPAD_C_COMPILER_GNU_FLAGS || CPPAD_C_COMPILER_MSVC_FLAGS
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 Testing ipopt::solve
@@ -96,12 +96,14 @@ bool ipopt_solve(void)
     double rel_tol    = 1e-6;  // relative tolerance
     double abs_tol    = 1e-6;  // absolute tolerance
 
-    for(i = 0; i < 3; i++)
+    for(i = 0; i < 4; i++)
     {   std::string options( base_options );
         if( i == 1 )
             options += "Sparse true forward\n";
         if( i == 2 )
             options += "Sparse true reverse\n";
+        if( i == 3 )
+            options += "Sparse true subgraph\n";
 
         // solve the problem
         CppAD::ipopt::solve<Dvector, FG_eval>(
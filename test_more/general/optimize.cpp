@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 // 2DO: Test that optimize.hpp use of atomic_base<Base>::rev_sparse_jac works.
 
@@ -2413,6 +2413,92 @@ namespace {
         }
         return ok;
     }
+    // ----------------------------------------------------------------
+    // check jumping over runs of contiguous operators that are skipped
+    bool cond_exp_skip_run(void)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::NearEqual;
+        double eps10 = 10.0 * std::numeric_limits<double>::epsilon();
+        using CppAD::vector;
+
+        // independent variable vector
+        size_t n = 3;
+        vector< AD<double> > ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        Independent(ax);
+
+        // value when the comparison is true (a run of operators that
+        // includes a cumulative sum and a nested conditional expression)
+        AD<double> atrue = ax[2];
+        for(size_t k = 0; k < 10; ++k)
+            atrue = sin(atrue) * ax[2] + atrue + ax[1];
+        atrue = CondExpLt(ax[1], ax[2], atrue, cos(atrue) );
+        atrue = atrue * ax[2];
+
+        // value when the comparison is false (another run of operators)
+        AD<double> afalse = ax[1];
+        for(size_t k = 0; k < 10; ++k)
+            afalse = exp( afalse / 10.0 ) - ax[2];
+
+        // conditional expression
+        ay[0] = CondExpLt(ax[0], ax[1], atrue, afalse);
+
+        // g = f before optimization
+        CppAD::ADFun<double> f(ax, ay), g;
+        g = f;
+        optimize_with_options(f);
+
+        // skip_run_bytes
+        // bytes used for the runs of operators that conditional skip
+        // operators jump over (zero if there are no conditional skips)
+        size_t skip_run_bytes = 0;
+        CppAD::vector<CppAD::memory_report_record> report = f.memory_report();
+        for(size_t i = 0; i < report.size(); ++i)
+        {   if( report[i].name == "skip_run" )
+                skip_run_bytes = report[i].bytes;
+        }
+        ok &= (skip_run_bytes > 0) == conditional_skip_;
+
+        // compare zero order forward and first order reverse
+        vector<double> x(n), y(1), w(1), dw(n);
+        vector<double> y_check(1), dw_check(n);
+        w[0] = 1.0;
+        for(size_t i = 0; i < 4; i++)
+        {   x[0] = 1.0 - double(i);
+            x[1] = 0.5;
+            x[2] = 2.0 * double(i % 2) - 0.5;
+            //
+            // when i is zero, the comparison is false and the run of
+            // operators for the true case (including the Sin operators)
+            // is not evaluated by zero order forward mode
+            f.sweep_profile( i == 0 );
+            y        = f.Forward(0, x);
+            if( i == 0 )
+            {   size_t sin_count = 0;
+                CppAD::vector<CppAD::sweep_profile_record> profile =
+                    f.sweep_profile();
+                for(size_t k = 0; k < profile.size(); ++k)
+                {   if( profile[k].sweep == "forward_0" &&
+                        profile[k].name  == "Sin"
+                    )
+                        sin_count = profile[k].count;
+                }
+                if( conditional_skip_ )
+                    ok &= sin_count == 0;
+                else
+                    ok &= sin_count == 10;
+            }
+            y_check  = g.Forward(0, x);
+            ok      &= NearEqual(y[0], y_check[0], eps10, eps10);
+            dw       = f.Reverse(1, w);
+            dw_check = g.Reverse(1, w);
+            for(size_t j = 0; j < n; ++j)
+                ok &= NearEqual(dw[j], dw_check[j], eps10, eps10);
+        }
+        return ok;
+    }
 }
 
 bool optimize(void)
@@ -2553,6 +2639,8 @@ bool optimize(void)
         ok     &= cond_exp_if_false_used_after();
         // check case that has non-empty binary intersection operation
         ok     &= intersect_cond_exp();
+        // check jumping over runs of operators that are skipped
+        ok     &= cond_exp_skip_run();
     }
 
     // not using conditional_skip or atomic functions
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+Test that the thread number cached by AD<Base>::tape_ptr() for a system
+thread is not used after parallel_setup changes the thread number for that
+system thread. This system thread records as thread zero, then as thread
+one after a second parallel_setup, then as thread zero again.
+*/
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::thread_alloc;
+    using CppAD::AD;
+    //
+    // parallel_, thread_
+    bool   parallel_ = false;
+    size_t thread_   = 0;
+    //
+    // in_parallel
+    bool in_parallel(void)
+    {   return parallel_; }
+    //
+    // thread_number
+    size_t thread_number(void)
+    {   return thread_; }
+    //
+    // record
+    // record f(x) = x_0 * x_1 using the current thread and check it
+    bool record(void)
+    {   bool ok = true;
+        CPPAD_TESTVECTOR( AD<double> ) ax(2), ay(1);
+        ax[0] = 2.0;
+        ax[1] = 3.0;
+        CppAD::Independent(ax);
+        ay[0] = ax[0] * ax[1];
+        ok &= CppAD::Variable( ay[0] );
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        CPPAD_TESTVECTOR(double) x(2), dy(2);
+        x[0] = 4.0;
+        x[1] = 5.0;
+        dy   = f.Jacobian(x);
+        ok  &= dy[0] == x[1];
+        ok  &= dy[1] == x[0];
+        return ok;
+    }
+}
+
+bool tape_cache(void)
+{   bool ok = true;
+    //
+    // cache thread number zero for this system thread
+    ok &= record();
+    //
+    // this system thread becomes thread number one
+    size_t num_threads = 2;
+    thread_alloc::parallel_setup(num_threads, in_parallel, thread_number);
+    CppAD::parallel_ad<double>();
+    //
+    // parallel_ad used the cache for thread number zero.
+    // A system thread can only change its thread number
+    // when parallel_setup is called.
+    thread_alloc::parallel_setup(num_threads, in_parallel, thread_number);
+    thread_ = 1;
+    parallel_ = true;
+    //
+    // an operation that uses the cache before this thread starts recording
+    // (the cache for thread number zero is not valid after parallel_setup)
+    AD<double> a = 1.0;
+    AD<double> b = a + a;
+    ok &= CppAD::Parameter(b);
+    ok &= record();
+    //
+    // back to sequential mode using thread number zero
+    parallel_ = false;
+    thread_   = 0;
+    thread_alloc::parallel_setup(1, nullptr, nullptr);
+    thread_alloc::free_available(1);
+    ok &= record();
+    //
+    return ok;
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+Test memory that one thread allocates and another thread returns.
+The memory must go back to the allocating thread and be reused by it
+(when memory is held), and it must be freed by free_available.
+Both thread numbers are used from one system thread by changing
+the value of thread_ between calls.
+*/
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::thread_alloc;
+    //
+    // parallel_, thread_
+    bool   parallel_ = false;
+    size_t thread_   = 0;
+    //
+    // in_parallel
+    bool in_parallel(void)
+    {   return parallel_; }
+    //
+    // thread_number
+    size_t thread_number(void)
+    {   return thread_; }
+    //
+    // test_remote
+    bool test_remote(bool hold)
+    {   bool ok = true;
+        //
+        // hold_memory
+        thread_alloc::hold_memory(hold);
+        //
+        // parallel_setup
+        size_t num_threads = 2;
+        thread_alloc::parallel_setup(num_threads, in_parallel, thread_number);
+        parallel_ = true;
+        //
+        // v_ptr
+        // allocated by thread one
+        thread_ = 1;
+        size_t min_bytes = 100;
+        size_t cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        ok &= thread_alloc::inuse(1) == cap_bytes;
+        //
+        // vec
+        // allocated by thread one
+        CppAD::vector<double> vec(10);
+        size_t vec_bytes = thread_alloc::inuse(1) - cap_bytes;
+        ok &= 10 * sizeof(double) <= vec_bytes;
+        //
+        // returned by thread zero
+        thread_ = 0;
+        thread_alloc::return_memory(v_ptr);
+        vec.clear();
+        //
+        // ok
+        // thread one moves the memory from its remote return list
+        thread_ = 1;
+        ok &= thread_alloc::inuse(1) == 0;
+        if( hold )
+            ok &= thread_alloc::available(1) == cap_bytes + vec_bytes;
+        else
+            ok &= thread_alloc::available(1) == 0;
+        //
+        // ok
+        // thread one reuses the memory that thread zero returned
+        // (when memory is not held, it was returned to the system)
+        v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        void* remote_ptr = v_ptr;
+        thread_ = 0;
+        thread_alloc::return_memory(v_ptr);
+        thread_ = 1;
+        v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        ok &= thread_alloc::inuse(1) == cap_bytes;
+        if( hold )
+            ok &= v_ptr == remote_ptr;
+        //
+        // ok
+        // memory on the remote return list is freed by free_available
+        thread_ = 0;
+        thread_alloc::return_memory(v_ptr);
+        parallel_ = false;
+        thread_alloc::parallel_setup(1, nullptr, nullptr);
+        thread_alloc::free_available(1);
+        thread_alloc::free_available(0);
+        ok &= thread_alloc::inuse(1) == 0;
+        ok &= thread_alloc::available(1) == 0;
+        //
+        // hold_memory
+        thread_alloc::hold_memory(false);
+        //
+        return ok;
+    }
+}
+
+bool thread_alloc_remote(void)
+{   bool ok = true;
+    ok &= test_remote(true);
+    ok &= test_remote(false);
+    return ok;
+}
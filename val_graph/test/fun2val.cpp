@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2023-24 Bradley M. Bell
+// SPDX-FileContributor: 2023-26 Bradley M. Bell
 # include <cppad/cppad.hpp>
 # include <cppad/local/val_graph/tape.hpp>
 # include "../atomic_xam.hpp"
@@ -618,10 +618,73 @@ bool vector_op(void)
     return ok;
 }
 // ----------------------------------------------------------------------------
+// many_vector_op
+// Check vec_initial when there are many dynamic vectors
+// (vec_initial grows multiple times during fun2val).
+bool many_vector_op(void)
+{   bool ok = true;
+    //
+    // AD, addr_t
+    using CppAD::AD;
+    using CppAD::addr_t;
+    //
+    // tape_t, Vector
+    using CppAD::local::val_graph::tape_t;
+    using CppAD::local::val_graph::Vector;
+    //
+    // n_vec, n_ele
+    size_t n_vec = 20;
+    size_t n_ele = 3;
+    //
+    // ax
+    Vector< AD<double> > ax(1);
+    ax[0] = 0.0;
+    CppAD::Independent(ax);
+    //
+    // ay
+    Vector< AD<double> > ay(n_vec);
+    for(size_t k = 0; k < n_vec; ++k)
+    {   CppAD::VecAD<double> av(n_ele);
+        for(size_t i = 0; i < n_ele; ++i)
+            av[ AD<double>(i) ] = double(k * n_ele + i);
+        ay[k] = av[ ax[0] ];
+    }
+    //
+    // f
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // tape
+    tape_t<double> tape;
+    f.fun2val(tape);
+    //
+    // vec_initial
+    const Vector< Vector<addr_t> >& vec_initial = tape.vec_initial();
+    ok &= vec_initial.size() == n_vec;
+    for(size_t k = 0; k < vec_initial.size(); ++k)
+        ok &= vec_initial[k].size() == n_ele;
+    //
+    // x, val_vec
+    Vector<double> x(1);
+    x[0] = 2.0;
+    Vector<double> val_vec( tape.n_val() );
+    val_vec[0] = x[0];
+    bool trace = false;
+    tape.eval(trace, val_vec);
+    //
+    // ok
+    Vector<addr_t> dep_vec = tape.dep_vec();
+    ok &= dep_vec.size() == n_vec;
+    for(size_t k = 0; k < n_vec; ++k)
+        ok &= val_vec[ dep_vec[k] ] == double(k * n_ele + size_t(x[0]));
+    //
+    return ok;
+}
+// ----------------------------------------------------------------------------
 } // END_EMPTY_NAMESPACE
 bool test_fun2val(void)
 {   bool ok = true;
     ok     &= vector_op();
+    ok     &= many_vector_op();
     ok     &= dynamic_atom();
     ok     &= variable_atom();
     ok     &= unary_op();